@@ -434,7 +434,8 @@ namespace TEN::Entities::Player
 		float radius = TestState(item.Animation.ActiveState, CROUCH_STATES) ? LARA_RADIUS_CRAWL : LARA_RADIUS;
 
 		// Get center point collision.
-		auto pointCollCenter = GetPointCollision(item, 0, 0.0f, -LARA_HEIGHT / 2);
+		auto probes = PointCollisionBatch(item);
+		auto pointCollCenter = probes.Get(0, 0.0f, -LARA_HEIGHT / 2);
 		int floorToCeilHeightCenter = abs(pointCollCenter.GetCeilingHeight() - pointCollCenter.GetFloorHeight());
 
 		// Assess center point collision.
@@ -447,7 +448,7 @@ namespace TEN::Entities::Player
 		// TODO: Check whether < or <= and > or >=.
 
 		// Get front point collision.
-		auto pointCollFront = GetPointCollision(item, item.Pose.Orientation.y, radius, -coll.Setup.Height);
+		auto pointCollFront = probes.Get(item.Pose.Orientation.y, radius, -coll.Setup.Height);
 		int floorToCeilHeightFront = abs(pointCollFront.GetCeilingHeight() - pointCollFront.GetFloorHeight());
 		int relFloorHeightFront = abs(pointCollFront.GetFloorHeight() - pointCollCenter.GetFloorHeight());
 
@@ -460,7 +461,7 @@ namespace TEN::Entities::Player
 		}
 
 		// Get back point collision.
-		auto pointCollBack = GetPointCollision(item, item.Pose.Orientation.y, -radius, -coll.Setup.Height);
+		auto pointCollBack = probes.Get(item.Pose.Orientation.y, -radius, -coll.Setup.Height);
 		int floorToCeilHeightBack = abs(pointCollBack.GetCeilingHeight() - pointCollBack.GetFloorHeight());
 		int relFloorHeightBack = abs(pointCollBack.GetFloorHeight() - pointCollCenter.GetFloorHeight());
 
@@ -529,13 +530,14 @@ namespace TEN::Entities::Player
 		// TODO: Extend point collision struct to also find water depths.
 		float dist = 0.0f;
 		auto pointColl0 = GetPointCollision(item);
+		auto probes = PointCollisionBatch(item);
 
 		// 3) Test continuity of path.
 		while (dist < PROBE_DIST_MAX)
 		{
 			// Get point collision.
 			dist += STEP_DIST;
-			auto pointColl1 = GetPointCollision(item, item.Pose.Orientation.y, dist, -LARA_HEIGHT_CRAWL);
+			auto pointColl1 = probes.Get(item.Pose.Orientation.y, dist, -LARA_HEIGHT_CRAWL);
 
 			int floorHeightDelta = abs(pointColl0.GetFloorHeight() - pointColl1.GetFloorHeight());
 			int floorToCeilHeight = abs(pointColl1.GetCeilingHeight() - pointColl1.GetFloorHeight());
@@ -817,6 +817,16 @@ void AimWeapon(ItemInfo& laraItem, ArmInfo& arm, const WeaponInfo& weaponInfo)
 
 // TODO: Include snowmobile gun in GetAmmo(), otherwise the player won't be able to shoot while controlling it. -- TokyoSU 2023.04.21
 FireWeaponType FireWeapon(LaraWeaponType weaponType, ItemInfo& targetEntity, ItemInfo& laraItem, const EulerAngles& armOrient)
+{
+	auto shot = WeaponShot{};
+	auto fireType = PrepareWeaponShot(weaponType, targetEntity, laraItem, armOrient, shot);
+	if (fireType != FireWeaponType::NoAmmo)
+		ResolveWeaponShot(laraItem, shot, false);
+
+	return fireType;
+}
+
+FireWeaponType PrepareWeaponShot(LaraWeaponType weaponType, ItemInfo& targetEntity, ItemInfo& laraItem, const EulerAngles& armOrient, WeaponShot& shot)
 {
 	auto& player = *GetLaraInfo(&laraItem);
 	auto& ammo = GetAmmo(player, weaponType);
@@ -851,14 +861,15 @@ FireWeaponType FireWeapon(LaraWeaponType weaponType, ItemInfo& targetEntity, Ite
 	GetFloor(pos.x, pos.y, pos.z, &roomNumber);
 	vOrigin.RoomNumber = roomNumber;
 
+	shot.WeaponType = weaponType;
+	shot.TargetEntityPtr = &targetEntity;
+	shot.JointIndex = NO_VALUE;
+	shot.Ray = LosRay{ vOrigin, GameVector(target) };
+
 	if (&targetEntity == nullptr)
-	{
-		auto vTarget = GameVector(target);
-		GetTargetOnLOS(&vOrigin, &vTarget, false, true);
 		return FireWeaponType::Miss;
-	}
 
-	auto spheres = targetEntity.GetSpheres();
+	const auto& spheres = targetEntity.GetSpheres();
 	int closestJointIndex = NO_VALUE;
 	float closestDist = INFINITY;
 	for (int i = 0; i < spheres.size(); i++)
@@ -875,24 +886,28 @@ FireWeaponType FireWeapon(LaraWeaponType weaponType, ItemInfo& targetEntity, Ite
 	}
 	
 	if (closestJointIndex < 0)
-	{
-		auto vTarget = GameVector(target);
-		GetTargetOnLOS(&vOrigin, &vTarget, false, true);
 		return FireWeaponType::Miss;
-	}
-	else
-	{
-		SaveGame::Statistics.Game.AmmoHits++;
-		target = origin + (directionNorm * closestDist);
-		auto vTarget = GameVector(target);
 
-		// NOTE: It seems that entities hit by the player in the normal way must have GetTargetOnLOS return false.
-		// It's strange, but this replicates original behaviour until we fully understand what is happening.
-		if (!GetTargetOnLOS(&vOrigin, &vTarget, false, true))
-			HitTarget(&laraItem, &targetEntity, &vTarget, weapon.Damage, false, closestJointIndex);
+	SaveGame::Statistics.Game.AmmoHits++;
+	target = origin + (directionNorm * closestDist);
 
-		return FireWeaponType::PossibleHit;
-	}
+	shot.JointIndex = closestJointIndex;
+	shot.Ray.Target = GameVector(target);
+	return FireWeaponType::PossibleHit;
+}
+
+// If shot ray was already tested with GetLosBatch(), its result is used instead of new LOS query.
+void ResolveWeaponShot(ItemInfo& laraItem, WeaponShot& shot, bool isBatched)
+{
+	auto vTarget = shot.Ray.Target;
+	bool hasLosHit = isBatched ?
+		GetTargetOnLOS(shot.Ray, false, true) :
+		GetTargetOnLOS(&shot.Ray.Origin, &vTarget, false, true);
+
+	// NOTE: It seems that entities hit by the player in the normal way must have GetTargetOnLOS return false.
+	// It's strange, but this replicates original behaviour until we fully understand what is happening.
+	if (shot.JointIndex != NO_VALUE && !hasLosHit)
+		HitTarget(&laraItem, shot.TargetEntityPtr, &vTarget, GetWeaponInfo(shot.WeaponType).Damage, false, shot.JointIndex);
 }
 
 void FindNewTarget(ItemInfo& laraItem, const WeaponInfo& weaponInfo)
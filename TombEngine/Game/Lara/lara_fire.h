@@ -1,4 +1,5 @@
 #pragma once
+#include "Game/control/los.h"
 #include "Game/Lara/lara.h"
 
 class EulerAngles;
@@ -43,6 +44,15 @@ struct WeaponInfo
 	int	  ExplosiveDamage = 0;
 };
 
+// Shot whose line of sight is resolved separately, so that several shots can share one LOS batch.
+struct WeaponShot
+{
+	LaraWeaponType WeaponType	   = LaraWeaponType::None;
+	ItemInfo*	   TargetEntityPtr = nullptr;
+	int			   JointIndex	   = NO_VALUE; // Target entity joint hit by shot.
+	LosRay		   Ray			   = {};
+};
+
 extern int FlashGrenadeAftershockTimer;
 extern WeaponInfo Weapons[(int)LaraWeaponType::NumWeapons];
 
@@ -58,6 +68,8 @@ GAME_OBJECT_ID	  GetWeaponObjectMeshID(ItemInfo& laraItem, LaraWeaponType weapon
 void HandleWeapon(ItemInfo& laraItem);
 void AimWeapon(ItemInfo& laraItem, ArmInfo& arm, const WeaponInfo& weaponInfo);
 FireWeaponType FireWeapon(LaraWeaponType weaponType, ItemInfo& targetEntity, ItemInfo& laraItem, const EulerAngles& armOrient);
+FireWeaponType PrepareWeaponShot(LaraWeaponType weaponType, ItemInfo& targetEntity, ItemInfo& laraItem, const EulerAngles& armOrient, WeaponShot& shot);
+void		   ResolveWeaponShot(ItemInfo& laraItem, WeaponShot& shot, bool isBatched);
 
 void FindNewTarget(ItemInfo& laraItem, const WeaponInfo& weaponInfo);
 void LaraTargetInfo(ItemInfo& laraItem, const WeaponInfo& weaponInfo);
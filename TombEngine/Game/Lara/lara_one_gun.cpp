@@ -390,6 +390,10 @@ void FireShotgun(ItemInfo& laraItem)
 	int scatter = ((player.Weapons[(int)LaraWeaponType::Shotgun].SelectedAmmo == WeaponAmmoType::Ammo1) ? 
 		ANGLE(SHOTGUN_NORMAL_PELLET_SCATTER) : ANGLE(SHOTGUN_WIDESHOT_PELLET_SCATTER));
 
+	auto shots = std::array<WeaponShot, SHOTGUN_PELLET_COUNT>{};
+	auto rays = std::vector<LosRay>{};
+	rays.reserve(SHOTGUN_PELLET_COUNT);
+
 	for (int i = 0; i < SHOTGUN_PELLET_COUNT; i++)
 	{
 		auto wobbledArmOrient = EulerAngles(
@@ -397,14 +401,26 @@ void FireShotgun(ItemInfo& laraItem)
 			armOrient.y + scatter * (GetRandomControl() - ANGLE(90.0f)) / 65536,
 			0);
 
-		if (FireWeapon(LaraWeaponType::Shotgun, *player.TargetEntity, laraItem, wobbledArmOrient) != FireWeaponType::NoAmmo)
+		auto& shot = shots[rays.size()];
+		if (PrepareWeaponShot(LaraWeaponType::Shotgun, *player.TargetEntity, laraItem, wobbledArmOrient, shot) != FireWeaponType::NoAmmo)
+		{
+			rays.push_back(shot.Ray);
 			hasFired = true;
+		}
 
 		// HACK: Compensate for spending 6 units of shotgun ammo. -- Lwmte, 18.11.22
 		if (!ammo.HasInfinite())
 			ammo++;
 	}
 
+	// Pellets share room traversal and object candidates, then are resolved in firing order.
+	GetLosBatch(rays, true);
+	for (int i = 0; i < rays.size(); i++)
+	{
+		shots[i].Ray = rays[i];
+		ResolveWeaponShot(laraItem, shots[i], true);
+	}
+
 	if (hasFired)
 	{
 		if (!ammo.HasInfinite())
@@ -448,6 +464,7 @@ void DrawShotgun(ItemInfo& laraItem, LaraWeaponType weaponType)
 		player.Control.Weapon.WeaponItem = CreateItem();
 		weaponItemPtr = &g_Level.Items[player.Control.Weapon.WeaponItem];
 		weaponItemPtr->ObjectNumber = GetWeaponObjectID(weaponType);
+		UpdateItemObjectIndex(player.Control.Weapon.WeaponItem);
 
 		if (weaponType == LaraWeaponType::RocketLauncher)
 		{
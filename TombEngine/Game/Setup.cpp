@@ -148,10 +148,8 @@ void InitializeSpecialEffects()
 		Particles[i].dynamic = -1;
 	}
 
-	NextFireSpark = 1;
-	NextSmokeSpark = 0;
-	NextGunShell = 0;
-	NextBlood = 0;
+	RebuildEffectPools();
+	RebuildParticlePool();
 
 	TEN::Entities::TR4::ClearBeetleSwarm();
 	TEN::Entities::Creatures::TR3::ClearFishSwarm();
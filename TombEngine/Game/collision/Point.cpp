@@ -1,6 +1,8 @@
 #include "framework.h"
 #include "Game/collision/Point.h"
 
+#include <chrono>
+
 #include "Game/collision/collide_room.h"
 #include "Game/collision/floordata.h"
 #include "Game/items.h"
@@ -499,6 +501,139 @@ namespace TEN::Collision::Point
 		return Vector3::Transform(Vector3::UnitY * sign, orient.ToRotationMatrix());
 	}
 
+	// Probes are cached per tick by exact position and room number. Resolved data is only valid until
+	// sectors change, so cache is invalidated on every tick and whenever bridges, doors or flipmaps change.
+	constexpr auto POINT_COLL_CACHE_SIZE = 1024;
+
+	struct PointCollisionCacheEntry
+	{
+		Vector3i		   Position	  = Vector3i::Zero;
+		int				   RoomNumber = 0;
+		unsigned int	   Generation = 0;
+		PointCollisionData Data		  = PointCollisionData(Vector3i::Zero, 0);
+	};
+
+	static auto			PointCollCache			 = std::vector<PointCollisionCacheEntry>{};
+	static auto			PointCollCacheStats		 = PointCollisionCacheStats{};
+	static auto			PointCollCacheLastStats	 = PointCollisionCacheStats{};
+	static unsigned int PointCollCacheGeneration = 1;
+	static bool			IsPointCollCacheEnabled	 = false;
+	static bool			IsPointCollTimingEnabled = TEN::Debug::DebugBuild; // Shipping builds only time probes with -benchmark.
+
+	static thread_local int	 PointCollProbeDepth   = 0;
+	static thread_local bool IsPointCollConcurrent = false;
+
+	static unsigned int GetPointCollisionCacheIndex(const Vector3i& pos, int roomNumber)
+	{
+		unsigned int hash = ((unsigned int)pos.x * 73856093u) ^ ((unsigned int)pos.y * 19349663u) ^
+							((unsigned int)pos.z * 83492791u) ^ ((unsigned int)roomNumber * 2654435761u);
+		return (hash & (POINT_COLL_CACHE_SIZE - 1));
+	}
+
+	template <typename TFunc>
+	static PointCollisionData GetCachedPointCollision(const Vector3i& pos, int roomNumber, TFunc createFunc)
+	{
+		if (!IsPointCollCacheEnabled || IsPointCollConcurrent)
+			return createFunc();
+
+		// Hit; return copy of resolved data.
+		const auto& entry = PointCollCache[GetPointCollisionCacheIndex(pos, roomNumber)];
+		if (entry.Generation == PointCollCacheGeneration && entry.Position == pos && entry.RoomNumber == roomNumber)
+		{
+			PointCollCacheStats.HitCount++;
+			return entry.Data;
+		}
+
+		// Miss; resolve commonly used data before storing.
+		PointCollCacheStats.MissCount++;
+
+		auto pointColl = createFunc();
+		pointColl.GetFloorHeight();
+		pointColl.GetCeilingHeight();
+
+		// NOTE: Resolving can probe recursively, so entry is fetched again.
+		PointCollCache[GetPointCollisionCacheIndex(pos, roomNumber)] = PointCollisionCacheEntry{ pos, roomNumber, PointCollCacheGeneration, pointColl };
+		return pointColl;
+	}
+
+	// Counts probe and, if timing is enabled, measures time spent resolving it. Nested probes are only counted towards outermost one.
+	// NOTE: Stats are not shared with worker threads, so concurrent probes are neither counted nor timed.
+	template <typename TFunc>
+	static PointCollisionData MeasureProbe(TFunc probeFunc)
+	{
+		if (PointCollProbeDepth > 0 || IsPointCollConcurrent)
+			return probeFunc();
+
+		PointCollProbeDepth++;
+		auto time0 = IsPointCollTimingEnabled ? std::chrono::high_resolution_clock::now() : std::chrono::high_resolution_clock::time_point{};
+
+		auto pointColl = probeFunc();
+
+		PointCollProbeDepth--;
+		PointCollCacheStats.ProbeCount++;
+
+		if (IsPointCollTimingEnabled)
+		{
+			auto time1 = std::chrono::high_resolution_clock::now();
+			PointCollCacheStats.ProbeTime += std::chrono::duration<double, std::micro>(time1 - time0).count();
+		}
+
+		return pointColl;
+	}
+
+	void EnablePointCollisionCache(bool enable)
+	{
+		IsPointCollCacheEnabled = enable;
+
+		if (enable && PointCollCache.empty())
+			PointCollCache.resize(POINT_COLL_CACHE_SIZE);
+
+		InvalidatePointCollisionCache();
+	}
+
+	void EnablePointCollisionTiming(bool enable)
+	{
+		IsPointCollTimingEnabled = enable;
+	}
+
+	void UpdatePointCollisionCache()
+	{
+		PointCollCacheLastStats = PointCollCacheStats;
+		PointCollCacheStats = {};
+
+		InvalidatePointCollisionCache();
+	}
+
+	// Changes whenever collision geometry changes (doors, bridges, flipmaps), as well as once per frame.
+	unsigned int GetPointCollisionGeneration()
+	{
+		return PointCollCacheGeneration;
+	}
+
+	void InvalidatePointCollisionCache()
+	{
+		PointCollCacheGeneration++;
+
+		// Reset stamps on wraparound to avoid false hits.
+		if (PointCollCacheGeneration == 0)
+		{
+			for (auto& entry : PointCollCache)
+				entry.Generation = 0;
+
+			PointCollCacheGeneration = 1;
+		}
+	}
+
+	PointCollisionCacheStats GetPointCollisionCacheStats()
+	{
+		return PointCollCacheLastStats;
+	}
+
+	void SetConcurrentPointCollision(bool isConcurrent)
+	{
+		IsPointCollConcurrent = isConcurrent;
+	}
+
 	static int GetProbeRoomNumber(const Vector3i& pos, const RoomVector& location, const Vector3i& probePos)
 	{
 		// Conduct L-shaped room traversal.
@@ -531,35 +666,48 @@ namespace TEN::Collision::Point
 
 	PointCollisionData GetPointCollision(const Vector3i& pos, int roomNumber)
 	{
-		// HACK: Ensure room number is correct if position extends to another room.
-		// Accounts for some calls to this function which directly pass offset position instead of using dedicated probe overloads.
-		GetFloor(pos.x, pos.y, pos.z, (short*)&roomNumber);
+		return MeasureProbe([&]()
+		{
+			return GetCachedPointCollision(pos, roomNumber, [&]()
+			{
+				// HACK: Ensure room number is correct if position extends to another room.
+				// Accounts for some calls to this function which directly pass offset position instead of using dedicated probe overloads.
+				short probeRoomNumber = roomNumber;
+				GetFloor(pos.x, pos.y, pos.z, &probeRoomNumber);
 
-		return PointCollisionData(pos, roomNumber);
+				return PointCollisionData(pos, probeRoomNumber);
+			});
+		});
 	}
 
 	PointCollisionData GetPointCollision(const Vector3i& pos, int roomNumber, const Vector3& dir, float dist)
 	{
-		// Get "location".
-		auto location = GetLocation(pos, roomNumber);
+		return MeasureProbe([&]()
+		{
+			// Get "location".
+			auto location = GetLocation(pos, roomNumber);
 
-		// Calculate probe position.
-		auto probePos = Geometry::TranslatePoint(pos, dir, dist);
-		short probeRoomNumber = GetProbeRoomNumber(pos, location, probePos);
+			// Calculate probe position.
+			auto probePos = Geometry::TranslatePoint(pos, dir, dist);
+			short probeRoomNumber = GetProbeRoomNumber(pos, location, probePos);
 
-		return PointCollisionData(probePos, probeRoomNumber);
+			return GetCachedPointCollision(probePos, probeRoomNumber, [&]() { return PointCollisionData(probePos, probeRoomNumber); });
+		});
 	}
 
 	PointCollisionData GetPointCollision(const Vector3i& pos, int roomNumber, short headingAngle, float forward, float down, float right, const Vector3& axis)
 	{
-		// Get "location".
-		auto location = GetLocation(pos, roomNumber);
+		return MeasureProbe([&]()
+		{
+			// Get "location".
+			auto location = GetLocation(pos, roomNumber);
 
-		// Calculate probe position.
-		auto probePos = Geometry::TranslatePoint(pos, headingAngle, forward, down, right, axis);
-		short probeRoomNumber = GetProbeRoomNumber(pos, location, probePos);
+			// Calculate probe position.
+			auto probePos = Geometry::TranslatePoint(pos, headingAngle, forward, down, right, axis);
+			short probeRoomNumber = GetProbeRoomNumber(pos, location, probePos);
 
-		return PointCollisionData(probePos, probeRoomNumber);
+			return GetCachedPointCollision(probePos, probeRoomNumber, [&]() { return PointCollisionData(probePos, probeRoomNumber); });
+		});
 	}
 
 	PointCollisionData GetPointCollision(const ItemInfo& item)
@@ -569,25 +717,90 @@ namespace TEN::Collision::Point
 
 	PointCollisionData GetPointCollision(const ItemInfo& item, const Vector3& dir, float dist)
 	{
-		// Get "location".
-		auto location = GetLocation(item);
+		return MeasureProbe([&]()
+		{
+			// Get "location".
+			auto location = GetLocation(item);
 
-		// Calculate probe position.
-		auto probePos = Geometry::TranslatePoint(item.Pose.Position, dir, dist);
-		short probeRoomNumber = GetProbeRoomNumber(item.Pose.Position, location, probePos);
+			// Calculate probe position.
+			auto probePos = Geometry::TranslatePoint(item.Pose.Position, dir, dist);
+			short probeRoomNumber = GetProbeRoomNumber(item.Pose.Position, location, probePos);
 
-		return PointCollisionData(probePos, probeRoomNumber);
+			return GetCachedPointCollision(probePos, probeRoomNumber, [&]() { return PointCollisionData(probePos, probeRoomNumber); });
+		});
 	}
 
 	PointCollisionData GetPointCollision(const ItemInfo& item, short headingAngle, float forward, float down, float right, const Vector3& axis)
 	{
-		// Get "location".
-		auto location = GetLocation(item);
+		return MeasureProbe([&]()
+		{
+			// Get "location".
+			auto location = GetLocation(item);
+
+			// Calculate probe position.
+			auto probePos = Geometry::TranslatePoint(item.Pose.Position, headingAngle, forward, down, right, axis);
+			short probeRoomNumber = GetProbeRoomNumber(item.Pose.Position, location, probePos);
 
-		// Calculate probe position.
-		auto probePos = Geometry::TranslatePoint(item.Pose.Position, headingAngle, forward, down, right, axis);
-		short probeRoomNumber = GetProbeRoomNumber(item.Pose.Position, location, probePos);
+			return GetCachedPointCollision(probePos, probeRoomNumber, [&]() { return PointCollisionData(probePos, probeRoomNumber); });
+		});
+	}
+
+	PointCollisionBatch::PointCollisionBatch(const ItemInfo& item)
+	{
+		_origin = item.Pose.Position;
+		_location = GetLocation(item);
+	}
+
+	PointCollisionBatch::PointCollisionBatch(const Vector3i& pos, int roomNumber)
+	{
+		_origin = pos;
+		_location = GetLocation(pos, roomNumber);
+	}
+
+	// Returns room number at origin X/Z and given height, traversed from origin location. Equivalent to first leg of L-shaped probe traversal.
+	int PointCollisionBatch::GetRoomNumber(int height)
+	{
+		for (int i = 0; i < _traversalCount; i++)
+		{
+			if (_traversals[i].Height == height)
+			{
+				if (!IsPointCollConcurrent)
+					PointCollCacheStats.SharedTraversalCount++;
+
+				return _traversals[i].RoomNumber;
+			}
+		}
+
+		int roomNumber = GetRoomVector(_location, Vector3i(_origin.x, height, _origin.z)).RoomNumber;
+
+		// Most batches probe at only a few heights. Once full, further heights are traversed without being stored.
+		if (_traversalCount < TRAVERSAL_COUNT_MAX)
+			_traversals[_traversalCount++] = Traversal{ height, roomNumber };
+
+		return roomNumber;
+	}
+
+	PointCollisionData PointCollisionBatch::Get(const Vector3& dir, float dist)
+	{
+		return Get(Geometry::TranslatePoint(_origin, dir, dist));
+	}
+
+	PointCollisionData PointCollisionBatch::Get(short headingAngle, float forward, float down, float right, const Vector3& axis)
+	{
+		return Get(Geometry::TranslatePoint(_origin, headingAngle, forward, down, right, axis));
+	}
+
+	PointCollisionData PointCollisionBatch::Get(const Vector3i& probePos)
+	{
+		if (!IsPointCollConcurrent)
+			PointCollCacheStats.BatchProbeCount++;
+
+		return MeasureProbe([&]()
+		{
+			short probeRoomNumber = GetRoomNumber(probePos.y);
+			GetFloor(probePos.x, probePos.y, probePos.z, &probeRoomNumber);
 
-		return PointCollisionData(probePos, probeRoomNumber);
+			return GetCachedPointCollision(probePos, probeRoomNumber, [&]() { return PointCollisionData(probePos, probeRoomNumber); });
+		});
 	}
 }
@@ -78,6 +78,58 @@ namespace TEN::Collision::Point
 		Vector3 GetBridgeNormal(bool isFloor);
 	};
 
+	// Probes several points around same origin. Origin location and vertical room traversal to each probe height
+	// are resolved once per batch and shared by all probes, instead of being redone by every probe.
+	// Results match equivalent GetPointCollision() overloads. Batch is only valid until origin or sectors change.
+	class PointCollisionBatch
+	{
+	private:
+		static constexpr auto TRAVERSAL_COUNT_MAX = 8;
+
+		struct Traversal
+		{
+			int Height	   = 0;
+			int RoomNumber = 0;
+		};
+
+		// Members
+
+		Vector3i   _origin	 = Vector3i::Zero;
+		RoomVector _location = RoomVector();
+
+		std::array<Traversal, TRAVERSAL_COUNT_MAX> _traversals	   = {};
+		int										   _traversalCount = 0;
+
+	public:
+		// Constructors
+
+		PointCollisionBatch(const ItemInfo& item);
+		PointCollisionBatch(const Vector3i& pos, int roomNumber);
+
+		// Getters
+
+		int GetRoomNumber(int height);
+
+		PointCollisionData Get(const Vector3& dir, float dist);
+		PointCollisionData Get(short headingAngle, float forward, float down = 0.0f, float right = 0.0f, const Vector3& axis = Vector3::UnitY);
+
+	private:
+		// Helpers
+
+		PointCollisionData Get(const Vector3i& probePos);
+	};
+
+	struct PointCollisionCacheStats
+	{
+		unsigned int HitCount  = 0;
+		unsigned int MissCount = 0;
+
+		unsigned int ProbeCount			  = 0;
+		unsigned int BatchProbeCount	  = 0;
+		unsigned int SharedTraversalCount = 0; // Vertical traversals reused by batched probes.
+		double		 ProbeTime			  = 0.0; // In microseconds.
+	};
+
 	PointCollisionData GetPointCollision(const Vector3i& pos, int roomNumber);
 	PointCollisionData GetPointCollision(const Vector3i& pos, int roomNumber, const Vector3& dir, float dist);
 	PointCollisionData GetPointCollision(const Vector3i& pos, int roomNumber, short headingAngle, float forward, float down = 0.0f, float right = 0.0f,
@@ -87,4 +139,16 @@ namespace TEN::Collision::Point
 	PointCollisionData GetPointCollision(const ItemInfo& item, const Vector3& dir, float dist);
 	PointCollisionData GetPointCollision(const ItemInfo& item, short headingAngle, float forward, float down = 0.0f, float right = 0.0f,
 										 const Vector3& axis = Vector3::UnitY);
+
+	// Per-tick probe cache
+
+	void EnablePointCollisionCache(bool enable);
+	void EnablePointCollisionTiming(bool enable);
+	void UpdatePointCollisionCache();
+	void InvalidatePointCollisionCache();
+	unsigned int GetPointCollisionGeneration();
+	PointCollisionCacheStats GetPointCollisionCacheStats();
+
+	// Probes made while concurrent mode is set on calling thread bypass shared cache and stats.
+	void SetConcurrentPointCollision(bool isConcurrent);
 }
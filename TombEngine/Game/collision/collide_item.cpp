@@ -47,7 +47,7 @@ void GenericSphereBoxCollision(short itemNumber, ItemInfo* playerItem, Collision
 
 	short prevYOrient = item.Pose.Orientation.y;
 	item.Pose.Orientation.y = 0;
-	auto spheres = item.GetSpheres();
+	const auto& spheres = item.GetSpheres();
 	item.Pose.Orientation.y = prevYOrient;
 
 	int harmBits = *(int*)&item.ItemFlags[0]; // NOTE: Value spread across ItemFlags[0] and ItemFlags[1].
@@ -702,10 +702,11 @@ void AlignEntityToSurface(ItemInfo* item, const Vector2& ellipse, float alpha, s
 	auto reducedEllipse = ellipse * 0.75f;
 
 	// Probe heights at points around entity.
-	int frontHeight = GetPointCollision(*item, item->Pose.Orientation.y, reducedEllipse.y).GetFloorHeight();
-	int backHeight	= GetPointCollision(*item, item->Pose.Orientation.y + ANGLE(180.0f), reducedEllipse.y).GetFloorHeight();
-	int leftHeight	= GetPointCollision(*item, item->Pose.Orientation.y - ANGLE(90.0f), reducedEllipse.x).GetFloorHeight();
-	int rightHeight = GetPointCollision(*item, item->Pose.Orientation.y + ANGLE(90.0f), reducedEllipse.x).GetFloorHeight();
+	auto probes = PointCollisionBatch(*item);
+	int frontHeight = probes.Get(item->Pose.Orientation.y, reducedEllipse.y).GetFloorHeight();
+	int backHeight	= probes.Get(item->Pose.Orientation.y + ANGLE(180.0f), reducedEllipse.y).GetFloorHeight();
+	int leftHeight	= probes.Get(item->Pose.Orientation.y - ANGLE(90.0f), reducedEllipse.x).GetFloorHeight();
+	int rightHeight = probes.Get(item->Pose.Orientation.y + ANGLE(90.0f), reducedEllipse.x).GetFloorHeight();
 
 	// Calculate height deltas.
 	int forwardHeightDelta = backHeight - frontHeight;
@@ -19,6 +19,104 @@ using namespace TEN::Math;
 using namespace TEN::Utils;
 using namespace TEN::Renderer;
 
+namespace TEN::Collision::Floordata
+{
+	// Bridge table indexed by item number. Caches bridge box and its XZ extents, so that sector bridge lists can reject
+	// bridges outside probe column without calling their height routines. Entry is refreshed whenever bridge pose or
+	// animation frame changes. Also tracks sector range last touched by UpdateBridgeItem() to update moving bridges incrementally.
+	// NOTE: Table is only sized by InitializeBridgeCache(), as queries may run on worker threads after UpdateBridgeCache().
+	struct BridgeCacheData
+	{
+		bool			IsValid		 = false;
+		GAME_OBJECT_ID	ObjectNumber = ID_NO_OBJECT; // Item slots may be reused by created items.
+		Pose			ItemPose	 = Pose::Zero;
+		int				AnimNumber	 = NO_VALUE;
+		int				FrameNumber	 = NO_VALUE;
+
+		BoundingOrientedBox Box	  = {};
+		Vector2				Min	  = Vector2::Zero; // XZ extents.
+		Vector2				Max	  = Vector2::Zero; // XZ extents.
+
+		int		 SectorRoomNumber = NO_VALUE; // NO_VALUE if touched sectors are unknown.
+		Vector2i SectorMin		  = Vector2i::Zero;
+		Vector2i SectorMax		  = Vector2i::Zero;
+	};
+
+	static auto BridgeCache = std::vector<BridgeCacheData>{};
+
+	static BridgeCacheData& GetBridgeCacheData(const ItemInfo& item)
+	{
+		TENAssert(item.Index < BridgeCache.size(), "Bridge cache queried for item outside level item array.");
+
+		auto& data = BridgeCache[item.Index];
+		if (data.IsValid &&
+			data.ObjectNumber == item.ObjectNumber &&
+			data.AnimNumber == item.Animation.AnimNumber &&
+			data.FrameNumber == item.Animation.FrameNumber &&
+			data.ItemPose == item.Pose)
+		{
+			return data;
+		}
+
+		data.IsValid = true;
+		data.ObjectNumber = item.ObjectNumber;
+		data.ItemPose = item.Pose;
+		data.AnimNumber = item.Animation.AnimNumber;
+		data.FrameNumber = item.Animation.FrameNumber;
+		data.Box = GameBoundingBox(&item).ToBoundingOrientedBox(item.Pose);
+
+		auto corners = std::array<Vector3, 8>{};
+		data.Box.GetCorners(corners.data());
+
+		data.Min = Vector2(corners[0].x, corners[0].z);
+		data.Max = data.Min;
+		for (const auto& corner : corners)
+		{
+			data.Min = Vector2::Min(data.Min, Vector2(corner.x, corner.z));
+			data.Max = Vector2::Max(data.Max, Vector2(corner.x, corner.z));
+		}
+
+		return data;
+	}
+
+	// All bridge height routines are bound by bridge box, so bridge can't have surface outside its XZ extents.
+	static bool TestBridgeColumn(const ItemInfo& bridgeItem, const Vector3i& pos)
+	{
+		constexpr auto MARGIN = 1.0f;
+
+		const auto& data = GetBridgeCacheData(bridgeItem);
+		return (pos.x >= (data.Min.x - MARGIN) && pos.x <= (data.Max.x + MARGIN) &&
+				pos.z >= (data.Min.y - MARGIN) && pos.z <= (data.Max.y + MARGIN));
+	}
+
+	static void ExpandBridgeSectorRange(const ItemInfo& bridgeItem, int x, int z)
+	{
+		auto& data = GetBridgeCacheData(bridgeItem);
+		if (data.SectorRoomNumber != bridgeItem.RoomNumber)
+			return;
+
+		auto roomGridCoord = GetRoomGridCoord(bridgeItem.RoomNumber, x, z);
+		data.SectorMin = Vector2i(std::min(data.SectorMin.x, roomGridCoord.x), std::min(data.SectorMin.y, roomGridCoord.y));
+		data.SectorMax = Vector2i(std::max(data.SectorMax.x, roomGridCoord.x), std::max(data.SectorMax.y, roomGridCoord.y));
+	}
+
+	void InitializeBridgeCache()
+	{
+		BridgeCache.assign(g_Level.Items.size(), BridgeCacheData{});
+	}
+
+	// Refreshes all bridge entries, so that following queries only read table. Required before probing from worker threads.
+	void UpdateBridgeCache()
+	{
+		for (int i = 0; i < g_Level.Items.size(); i++)
+		{
+			const auto& item = g_Level.Items[i];
+			if (item.IsBridge() && Objects[item.ObjectNumber].loaded)
+				GetBridgeCacheData(item);
+		}
+	}
+}
+
 int FloorInfo::GetSurfaceTriangleID(int x, int z, bool isFloor) const
 {
 	constexpr auto TRI_ID_0 = 0;
@@ -136,6 +234,9 @@ std::optional<int> FloorInfo::GetNextRoomNumber(const Vector3i& pos, bool isBelo
 	for (int itemNumber : BridgeItemNumbers)
 	{
 		const auto& bridgeItem = g_Level.Items[itemNumber];
+		if (!TestBridgeColumn(bridgeItem, pos))
+			continue;
+
 		const auto& bridge = GetBridgeObject(bridgeItem);
 
 		// 2.1) Get bridge floor or ceiling height.
@@ -196,6 +297,9 @@ int FloorInfo::GetSurfaceHeight(const Vector3i& pos, bool isFloor) const
 	for (int itemNumber : BridgeItemNumbers)
 	{
 		const auto& bridgeItem = g_Level.Items[itemNumber];
+		if (!TestBridgeColumn(bridgeItem, pos))
+			continue;
+
 		const auto& bridge = GetBridgeObject(bridgeItem);
 
 		// 2.1) Get bridge surface height.
@@ -236,6 +340,9 @@ int FloorInfo::GetBridgeSurfaceHeight(const Vector3i& pos, bool isFloor) const
 	for (int itemNumber : BridgeItemNumbers)
 	{
 		const auto& bridgeItem = g_Level.Items[itemNumber];
+		if (!TestBridgeColumn(bridgeItem, pos))
+			continue;
+
 		const auto& bridge = GetBridgeObject(bridgeItem);
 
 		// 1.1) Get bridge floor and ceiling heights.
@@ -293,6 +400,9 @@ int FloorInfo::GetInsideBridgeItemNumber(const Vector3i& pos, bool testFloorBord
 	for (int itemNumber : BridgeItemNumbers)
 	{
 		const auto& bridgeItem = g_Level.Items[itemNumber];
+		if (!TestBridgeColumn(bridgeItem, pos))
+			continue;
+
 		const auto& bridge = GetBridgeObject(bridgeItem);
 
 		// 1.1) Get bridge floor and ceiling heights.
@@ -323,12 +433,23 @@ int FloorInfo::GetInsideBridgeItemNumber(const Vector3i& pos, bool testFloorBord
 
 void FloorInfo::AddBridge(int itemNumber)
 {
-	BridgeItemNumbers.insert(itemNumber);
+	// Insert in sorted order to keep traversal order stable.
+	auto it = std::lower_bound(BridgeItemNumbers.begin(), BridgeItemNumbers.end(), itemNumber);
+	if (it != BridgeItemNumbers.end() && *it == itemNumber)
+		return;
+
+	BridgeItemNumbers.insert(it, itemNumber);
+	InvalidatePointCollisionCache();
 }
 
 void FloorInfo::RemoveBridge(int itemNumber)
 {
-	BridgeItemNumbers.erase(itemNumber);
+	auto it = std::lower_bound(BridgeItemNumbers.begin(), BridgeItemNumbers.end(), itemNumber);
+	if (it == BridgeItemNumbers.end() || *it != itemNumber)
+		return;
+
+	BridgeItemNumbers.erase(it);
+	InvalidatePointCollisionCache();
 }
 
 namespace TEN::Collision::Floordata
@@ -703,6 +824,8 @@ namespace TEN::Collision::Floordata
 		x += bridgeItem.Pose.Position.x;
 		z += bridgeItem.Pose.Position.z;
 
+		ExpandBridgeSectorRange(bridgeItem, x, z);
+
 		auto* sector = &GetSideSector(bridgeItem.RoomNumber, x, z);
 		sector->AddBridge(itemNumber);
 
@@ -786,7 +909,10 @@ namespace TEN::Collision::Floordata
 	{
 		constexpr auto VERTICAL_MARGIN = 4;
 
-		auto box = GameBoundingBox(&item).ToBoundingOrientedBox(item.Pose);
+		if (!TestBridgeColumn(item, pos))
+			return std::nullopt;
+
+		const auto& box = GetBridgeCacheData(item).Box;
 		
 		auto origin = Vector3(pos.x, pos.y + (useBottomHeight ? VERTICAL_MARGIN : -VERTICAL_MARGIN), pos.z);
 		auto dir = useBottomHeight ? -Vector3::UnitY : Vector3::UnitY;
@@ -821,8 +947,12 @@ namespace TEN::Collision::Floordata
 		if (item.Flags & IFLAG_KILLED)
 			forceRemoval = true;
 
+		// Bridge may have moved within same sectors, which AddBridge() and RemoveBridge() don't detect.
+		InvalidatePointCollisionCache();
+
 		// Get bridge OBB.
-		auto bridgeBox = GameBoundingBox(&item).ToBoundingOrientedBox(item.Pose);
+		auto& bridgeData = GetBridgeCacheData(item);
+		const auto& bridgeBox = bridgeData.Box;
 
 		// Get bridge OBB corners. NOTE: only 0, 1, 4, 5 are relevant.
 		auto corners = std::array<Vector3, 8>{};
@@ -836,10 +966,42 @@ namespace TEN::Collision::Floordata
 		float xMax =  ceil((std::max(std::max(std::max(corners[0].x, corners[1].x), corners[4].x), corners[5].x) - room.Position.x) / BLOCK(1));
 		float zMax =  ceil((std::max(std::max(std::max(corners[0].z, corners[1].z), corners[4].z), corners[5].z) - room.Position.z) / BLOCK(1));
 
+		// Only visit sectors bridge was added to on previous update and sectors it may be added to now.
+		// If previous sectors are unknown (first update, room change), sweep whole room.
+		int sweepXMin = 0;
+		int sweepZMin = 0;
+		int sweepXMax = room.XSize - 1;
+		int sweepZMax = room.ZSize - 1;
+		if (bridgeData.SectorRoomNumber == item.RoomNumber)
+		{
+			sweepXMin = bridgeData.SectorMin.x;
+			sweepZMin = bridgeData.SectorMin.y;
+			sweepXMax = bridgeData.SectorMax.x;
+			sweepZMax = bridgeData.SectorMax.y;
+
+			if (!forceRemoval)
+			{
+				sweepXMin = std::min(sweepXMin, (int)xMin);
+				sweepZMin = std::min(sweepZMin, (int)zMin);
+				sweepXMax = std::max(sweepXMax, (int)xMax);
+				sweepZMax = std::max(sweepZMax, (int)zMax);
+			}
+
+			sweepXMin = std::max(sweepXMin, 0);
+			sweepZMin = std::max(sweepZMin, 0);
+			sweepXMax = std::min(sweepXMax, room.XSize - 1);
+			sweepZMax = std::min(sweepZMax, room.ZSize - 1);
+		}
+
+		// Start new sector range. AddBridge() expands it with every sector bridge is added to.
+		bridgeData.SectorRoomNumber = item.RoomNumber;
+		bridgeData.SectorMin = Vector2i(room.XSize, room.ZSize);
+		bridgeData.SectorMax = Vector2i(NO_VALUE, NO_VALUE);
+
 		// Run through sectors enclosed in projected bridge AABB.
-		for (int x = 0; x < room.XSize; x++)
+		for (int x = sweepXMin; x <= sweepXMax; x++)
 		{
-			for (int z = 0; z < room.ZSize; z++)
+			for (int z = sweepZMin; z <= sweepZMax; z++)
 			{
 				float pX = (room.Position.x + BLOCK(x)) + BLOCK(0.5f);
 				float pZ = (room.Position.z + BLOCK(z)) + BLOCK(0.5f);
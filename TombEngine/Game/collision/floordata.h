@@ -1,5 +1,6 @@
 #pragma once
 #include "Math/Math.h"
+#include "Specific/memory/SmallVector.h"
 #include "Specific/newtypes.h"
 
 using namespace TEN::Math;
@@ -21,7 +22,7 @@ struct ItemInfo;
 // Triangle:		Surface subdivision. Only 2 per surface can exist.
 // Wall:			Inferred from a high floor or ceiling. Note that true "walls" don't exist in floordata, only surface heights.
 
-enum class MaterialType
+enum class MaterialType : unsigned char
 {
 	Mud = 0,
 	Snow = 1,
@@ -72,10 +73,11 @@ public:
 	}
 };
 
+// NOTE: Members ordered and sized to keep sector footprint small. Room numbers fit in short (see NUM_ROOMS).
 struct SectorSurfaceTriangleData
 {
 	Plane		 Plane			  = {};
-	int			 PortalRoomNumber = 0;
+	short		 PortalRoomNumber = 0;
 	short		 SteepSlopeAngle  = 0;
 	MaterialType Material		  = MaterialType::Stone;
 };
@@ -134,6 +136,9 @@ struct SectorFlagData
 // SectorData
 class FloorInfo
 {
+private:
+	static constexpr auto BRIDGE_INLINE_COUNT = 4;
+
 public:
 	// Members
 	Vector2i		  Position		 = Vector2i::Zero;
@@ -142,8 +147,8 @@ public:
 	SectorSurfaceData CeilingSurface = {};
 	SectorFlagData	  Flags			 = {};
 
-	std::set<int> BridgeItemNumbers	   = {};
-	int			  SidePortalRoomNumber = 0;
+	TEN::Memory::SmallVector<int, BRIDGE_INLINE_COUNT> BridgeItemNumbers	= {}; // Sorted. Stored inline for common case of few bridges per sector.
+	int												   SidePortalRoomNumber = 0;
 
 	int	 PathfindingBoxID = 0;
 	int	 TriggerIndex	  = 0;
@@ -202,6 +207,8 @@ namespace TEN::Collision::Floordata
 	std::optional<int> GetBridgeItemIntersect(const ItemInfo& item, const Vector3i& pos, bool useBottomHeight);
 	int	 GetBridgeBorder(const ItemInfo& item, bool isBottom);
 	void UpdateBridgeItem(const ItemInfo& item, bool forceRemoval = false);
+	void InitializeBridgeCache();
+	void UpdateBridgeCache();
 
 	bool TestMaterial(MaterialType refMaterial, const std::vector<MaterialType>& materials);
 	
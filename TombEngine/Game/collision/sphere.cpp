@@ -1,6 +1,8 @@
 #include "framework.h"
 #include "Game/collision/Sphere.h"
 
+#include <chrono>
+
 #include "Game/Lara/lara.h"
 #include "Game/items.h"
 #include "Game/Setup.h"
@@ -13,10 +15,110 @@ using namespace TEN::Renderer;
 
 namespace TEN::Collision::Sphere
 {
+	// Item spheres are cached in a pool indexed by item number. Entries are keyed by renderer animation revision,
+	// pose and object ID, so spheres are only recalculated when the item moves or its animation transforms change.
+	struct ItemSphereCacheEntry
+	{
+		bool		 IsValid	  = false;
+		unsigned int Revision	  = 0;
+		int			 ObjectNumber = NO_VALUE;
+		Pose		 ItemPose	  = Pose::Zero;
+
+		std::vector<BoundingSphere>	  Spheres = {};
+		std::optional<BoundingSphere> Bounds  = std::nullopt; // Merged from spheres with positive radius.
+	};
+
+	static auto ItemSphereCache		 = std::vector<ItemSphereCacheEntry>{};
+	static auto SphereCacheStats	 = ItemSphereCacheStats{};
+	static auto SphereCacheLastStats = ItemSphereCacheStats{};
+
+	static ItemSphereCacheEntry& GetItemSphereCacheEntry(const ItemInfo& item)
+	{
+		SphereCacheStats.QueryCount++;
+
+		// NOTE: Renderer uses native item data, so key is built from it rather than from passed item.
+		const auto& nativeItem = g_Level.Items[item.Index];
+		auto& entry = ItemSphereCache[item.Index];
+
+		unsigned int revision = g_Renderer.GetItemAnimationRevision(item.Index);
+		if (entry.IsValid && entry.Revision == revision &&
+			entry.ObjectNumber == nativeItem.ObjectNumber && entry.ItemPose == nativeItem.Pose)
+		{
+			return entry;
+		}
+
+		auto time0 = std::chrono::high_resolution_clock::now();
+
+		g_Renderer.GetSpheres(item.Index, entry.Spheres);
+
+		entry.Bounds = std::nullopt;
+		for (const auto& sphere : entry.Spheres)
+		{
+			if (sphere.Radius <= 0.0f)
+				continue;
+
+			if (entry.Bounds.has_value())
+			{
+				BoundingSphere::CreateMerged(*entry.Bounds, *entry.Bounds, sphere);
+			}
+			else
+			{
+				entry.Bounds = sphere;
+			}
+		}
+
+		entry.IsValid = true;
+		entry.Revision = revision;
+		entry.ObjectNumber = nativeItem.ObjectNumber;
+		entry.ItemPose = nativeItem.Pose;
+
+		auto time1 = std::chrono::high_resolution_clock::now();
+		SphereCacheStats.ComputeCount++;
+		SphereCacheStats.ComputeTime += std::chrono::duration<double, std::micro>(time1 - time0).count();
+
+		return entry;
+	}
+
+	const std::vector<BoundingSphere>& GetItemSpheres(const ItemInfo& item)
+	{
+		return GetItemSphereCacheEntry(item).Spheres;
+	}
+
+	std::optional<BoundingSphere> GetItemBoundingSphere(const ItemInfo& item)
+	{
+		return GetItemSphereCacheEntry(item).Bounds;
+	}
+
+	void InitializeItemSphereCache()
+	{
+		// NOTE: Pool is never resized after first use, so returned sphere references remain valid.
+		if (ItemSphereCache.empty())
+			ItemSphereCache.resize(ITEM_COUNT_MAX);
+
+		for (auto& entry : ItemSphereCache)
+			entry.IsValid = false;
+
+		SphereCacheStats = {};
+		SphereCacheLastStats = {};
+	}
+
+	void UpdateItemSphereCache()
+	{
+		SphereCacheLastStats = SphereCacheStats;
+		SphereCacheStats = {};
+	}
+
+	ItemSphereCacheStats GetItemSphereCacheStats()
+	{
+		return SphereCacheLastStats;
+	}
+
 	bool HandleItemSphereCollision(ItemInfo& item0, ItemInfo& item1)
 	{
-		auto spheres0 = item0.GetSpheres();
-		auto spheres1 = item1.GetSpheres();
+		const auto& entry0 = GetItemSphereCacheEntry(item0);
+		const auto& entry1 = GetItemSphereCacheEntry(item1);
+		const auto& spheres0 = entry0.Spheres;
+		const auto& spheres1 = entry1.Spheres;
 
 		item1.TouchBits.ClearAll();
 
@@ -26,6 +128,13 @@ namespace TEN::Collision::Sphere
 			return false;
 		}
 
+		// Early out if bounding spheres don't overlap; no sphere pair can intersect then.
+		if (!entry0.Bounds.has_value() || !entry1.Bounds.has_value() ||
+			!entry0.Bounds->Intersects(*entry1.Bounds))
+		{
+			return false;
+		}
+
 		// Run through item 0 spheres.
 		bool isCollided = false;
 		for (int i = 0; i < spheres0.size(); i++)
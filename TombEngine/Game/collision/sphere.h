@@ -4,5 +4,21 @@ struct ItemInfo;
 
 namespace TEN::Collision::Sphere
 {
+	struct ItemSphereCacheStats
+	{
+		unsigned int QueryCount	  = 0;
+		unsigned int ComputeCount = 0;
+		double		 ComputeTime  = 0.0; // Microseconds.
+	};
+
 	bool HandleItemSphereCollision(ItemInfo& item0, ItemInfo& item1);
+
+	// Per-item sphere cache
+
+	const std::vector<BoundingSphere>& GetItemSpheres(const ItemInfo& item);
+	std::optional<BoundingSphere> GetItemBoundingSphere(const ItemInfo& item);
+
+	void InitializeItemSphereCache();
+	void UpdateItemSphereCache();
+	ItemSphereCacheStats GetItemSphereCacheStats();
 }
@@ -0,0 +1,122 @@
+#include "framework.h"
+#include "Game/control/CreatureScheduler.h"
+
+#include "Game/camera.h"
+#include "Game/control/control.h"
+#include "Game/itemdata/creature_info.h"
+#include "Game/items.h"
+#include "Game/Lara/lara.h"
+#include "Game/misc.h"
+#include "Game/room.h"
+#include "Specific/level.h"
+
+// Creature AI level of detail. Mood, target and pathfinding of creatures far from player or outside rooms around camera
+// are updated at reduced rates, while animation and collision still run every frame. Updates of creatures within
+// same tier are staggered by item number, so that they are spread over frames instead of happening all at once.
+// Staleness is bounded per tier, and creatures which were just hurt are always updated.
+
+namespace TEN::Control::Scheduler
+{
+	static auto LodSettings	 = CreatureLodSettings{};
+	static auto LodStats	 = CreatureLodStats{};
+	static auto LodLastStats = CreatureLodStats{};
+
+	void SetCreatureLodSettings(const CreatureLodSettings& settings)
+	{
+		LodSettings = settings;
+
+		for (auto& frameCount : LodSettings.MaxStaleness)
+			frameCount = std::max(frameCount, 1);
+
+		LodSettings.MaxStaleness[(int)CreatureAIPriority::High] = 1;
+	}
+
+	const CreatureLodSettings& GetCreatureLodSettings()
+	{
+		return LodSettings;
+	}
+
+	void SetCreatureLodMaxStaleness(int frameCount)
+	{
+		auto settings = LodSettings;
+		for (auto& tierFrameCount : settings.MaxStaleness)
+			tierFrameCount = std::min(tierFrameCount, frameCount);
+
+		SetCreatureLodSettings(settings);
+	}
+
+	static bool IsRoomNearCamera(int roomNumber)
+	{
+		if (Camera.pos.RoomNumber == NO_VALUE)
+			return true;
+
+		return (roomNumber == Camera.pos.RoomNumber ||
+				g_Level.Rooms[Camera.pos.RoomNumber].NeighborRoomNumbers.Contains(roomNumber));
+	}
+
+	CreatureAIPriority GetCreatureLodTier(const ItemInfo& item)
+	{
+		if (item.HitStatus)
+			return CreatureAIPriority::High;
+
+		float distance = Vector3::Distance(item.Pose.Position.ToVector3(), LaraItem->Pose.Position.ToVector3()) / BLOCK(1);
+
+		int tier = (int)CreatureAIPriority::High;
+		while (tier > (int)CreatureAIPriority::None && distance > LodSettings.Ranges[tier])
+			tier--;
+
+		// Creatures outside rooms around camera can't be seen, so they drop one tier.
+		if (tier > (int)CreatureAIPriority::None && !IsRoomNearCamera(item.RoomNumber))
+			tier--;
+
+		return (CreatureAIPriority)tier;
+	}
+
+	// Called by mood and target routines. Decision is made once per frame, so that both use same result.
+	bool TestCreatureAIUpdate(ItemInfo& item)
+	{
+		auto& creature = *GetCreatureInfo(&item);
+		if (creature.LodFrame == GlobalCounter)
+			return creature.IsAIUpdateDue;
+
+		creature.LodFrame = GlobalCounter;
+		creature.Priority = GetCreatureLodTier(item);
+
+		int interval = LodSettings.MaxStaleness[(int)creature.Priority];
+		bool isDue = (interval <= 1 ||
+					  ((GlobalCounter + item.Index) % interval) == 0 ||
+					  creature.FramesSinceAIUpdate >= (interval - 1) ||
+					  creature.LOT.TargetBox == NO_VALUE);
+
+		creature.IsAIUpdateDue = isDue;
+		creature.FramesSinceAIUpdate = isDue ? 0 : (creature.FramesSinceAIUpdate + 1);
+
+		auto& tierStats = LodStats.Tiers[(int)creature.Priority];
+		tierStats.CreatureCount++;
+		isDue ? tierStats.UpdateCount++ : tierStats.SkipCount++;
+
+		return isDue;
+	}
+
+	void AddCreatureLodControlTime(const ItemInfo& item, double time)
+	{
+		if (!item.IsCreature())
+			return;
+
+		// Tier is only updated when creature runs mood or target routines, so compute it for creatures which didn't this frame.
+		const auto& creature = *GetCreatureInfo((ItemInfo*)&item);
+		auto tier = (creature.LodFrame == GlobalCounter) ? creature.Priority : GetCreatureLodTier(item);
+		LodStats.Tiers[(int)tier].ControlTime += time;
+	}
+
+	void UpdateCreatureLodStats()
+	{
+		LodLastStats = LodStats;
+		LodStats = {};
+	}
+
+	CreatureLodStats GetCreatureLodStats()
+	{
+		return LodLastStats;
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+enum class CreatureAIPriority;
+struct ItemInfo;
+
+namespace TEN::Control::Scheduler
+{
+	constexpr auto CREATURE_LOD_TIER_COUNT = 4;
+
+	// Arrays are indexed by CreatureAIPriority.
+	struct CreatureLodSettings
+	{
+		std::array<float, CREATURE_LOD_TIER_COUNT> Ranges		= { FLT_MAX, 31.0f, 18.0f, 8.0f }; // Max distance to player in blocks.
+		std::array<int, CREATURE_LOD_TIER_COUNT>   MaxStaleness = { 30, 8, 4, 1 };				   // Max game frames between AI updates.
+	};
+
+	struct CreatureLodTierStats
+	{
+		unsigned int CreatureCount = 0;
+		unsigned int UpdateCount   = 0;
+		unsigned int SkipCount	   = 0;
+		double		 ControlTime   = 0.0; // In microseconds.
+	};
+
+	struct CreatureLodStats
+	{
+		std::array<CreatureLodTierStats, CREATURE_LOD_TIER_COUNT> Tiers = {};
+	};
+
+	void SetCreatureLodSettings(const CreatureLodSettings& settings);
+	const CreatureLodSettings& GetCreatureLodSettings();
+	void SetCreatureLodMaxStaleness(int frameCount);
+
+	CreatureAIPriority GetCreatureLodTier(const ItemInfo& item);
+	bool TestCreatureAIUpdate(ItemInfo& item);
+
+	void AddCreatureLodControlTime(const ItemInfo& item, double time);
+	void UpdateCreatureLodStats();
+	CreatureLodStats GetCreatureLodStats();
+}
@@ -0,0 +1,267 @@
+#include "framework.h"
+#include "Game/control/CreatureSensing.h"
+
+#include <chrono>
+#include <execution>
+
+#include "Game/collision/floordata.h"
+#include "Game/collision/Point.h"
+#include "Game/control/box.h"
+#include "Game/control/lot.h"
+#include "Game/itemdata/creature_info.h"
+#include "Game/items.h"
+#include "Game/Lara/lara_helpers.h"
+#include "Game/misc.h"
+#include "Game/people.h"
+#include "Game/room.h"
+#include "Specific/level.h"
+
+using namespace TEN::Collision::Floordata;
+using namespace TEN::Collision::Point;
+
+// Creature sensing runs before item control routines and calculates AI info and target line of sight of all active
+// creatures in parallel. Sensing only reads world state and each creature writes its own entry, so results don't depend
+// on thread scheduling. Control routines then reuse sensed results if creature and its enemy are unchanged since.
+// Otherwise, e.g. if creature picked another enemy, its enemy moved, or a door or bridge changed earlier in control loop,
+// result is recalculated.
+
+namespace TEN::Control::Sensing
+{
+	struct CreatureSenseData
+	{
+		unsigned int Generation		= 0;
+		bool		 IsInfoConsumed = false;
+
+		// State result was calculated from.
+		const ItemInfo* Enemy			 = nullptr;
+		Pose			ItemPose		 = Pose::Zero;
+		int				ItemRoomNumber	 = 0;
+		int				ItemAnimNumber	 = 0;
+		int				ItemFrameNumber	 = 0;
+		Pose			EnemyPose		 = Pose::Zero;
+		int				EnemyRoomNumber	 = 0;
+		int				EnemyAnimNumber	 = 0;
+		int				EnemyFrameNumber = 0;
+		float			EnemyVelocity	 = 0.0f;
+		int				EnemyHitPoints	 = 0;
+		short			EnemyMoveAngle	 = 0;
+		bool			IsEnemyLow		 = false;
+		ZoneType		Zone			 = ZoneType::Basic;
+		int				BlockMask		 = 0;
+		int				SearchNumber	 = 0;
+		int				NodeSearchNumber = 0;
+		bool			Flip			 = false;
+		unsigned int	WorldGeneration	 = 0; // Point collision generation, changed by doors and bridges.
+
+		// Result.
+		AI_INFO Info		   = {};
+		int		BoxNumber	   = NO_VALUE;
+		int		EnemyBoxNumber = NO_VALUE;
+		bool	HasVisibility  = false;
+		bool	IsVisible	   = false;
+	};
+
+	static auto CreatureSenses	 = std::vector<CreatureSenseData>{};
+	static auto SenseItemNumbers = std::vector<int>{};
+	static auto SensingStats	 = CreatureSensingStats{};
+	static auto SensingLastStats = CreatureSensingStats{};
+	static auto SenseGeneration	 = 1u;
+	static auto IsSensingEnabled = false;
+
+	static ItemInfo* GetSenseEnemy(ItemInfo& item)
+	{
+		// NOTE: Creature without enemy targets player, see CreatureAIInfo().
+		auto* enemy = GetCreatureInfo(&item)->Enemy;
+		return ((enemy != nullptr) ? enemy : LaraItem);
+	}
+
+	static void SetSenseState(CreatureSenseData& data, const ItemInfo& item, const ItemInfo& enemy)
+	{
+		const auto& creature = *GetCreatureInfo((ItemInfo*)&item);
+
+		data.Enemy = &enemy;
+		data.ItemPose = item.Pose;
+		data.ItemRoomNumber = item.RoomNumber;
+		data.ItemAnimNumber = item.Animation.AnimNumber;
+		data.ItemFrameNumber = item.Animation.FrameNumber;
+		data.EnemyPose = enemy.Pose;
+		data.EnemyRoomNumber = enemy.RoomNumber;
+		data.EnemyAnimNumber = enemy.Animation.AnimNumber;
+		data.EnemyFrameNumber = enemy.Animation.FrameNumber;
+		data.EnemyVelocity = enemy.Animation.Velocity.z;
+		data.EnemyHitPoints = enemy.HitPoints;
+		data.EnemyMoveAngle = enemy.IsLara() ? GetLaraInfo(enemy).Control.MoveAngle : 0;
+		data.IsEnemyLow = enemy.IsLara() ? GetLaraInfo(enemy).Control.IsLow : false;
+		data.Zone = creature.LOT.Zone;
+		data.BlockMask = creature.LOT.BlockMask;
+		data.SearchNumber = creature.LOT.SearchNumber;
+		data.NodeSearchNumber = (data.BoxNumber != NO_VALUE) ? creature.LOT.Node[data.BoxNumber].searchNumber : 0;
+		data.Flip = FlipStatus;
+		data.WorldGeneration = GetPointCollisionGeneration();
+	}
+
+	// Pathfinding state is only relevant to AI info, not to line of sight.
+	static bool TestSenseState(const CreatureSenseData& data, const ItemInfo& item, const ItemInfo& enemy, bool testPathfinding)
+	{
+		auto state = data;
+		SetSenseState(state, item, enemy);
+
+		if (testPathfinding &&
+			(data.Zone != state.Zone ||
+			 data.BlockMask != state.BlockMask ||
+			 data.SearchNumber != state.SearchNumber ||
+			 data.NodeSearchNumber != state.NodeSearchNumber ||
+			 data.Flip != state.Flip))
+		{
+			return false;
+		}
+
+		return (data.WorldGeneration == state.WorldGeneration &&
+				data.Enemy == state.Enemy &&
+				data.ItemPose == state.ItemPose &&
+				data.ItemRoomNumber == state.ItemRoomNumber &&
+				data.ItemAnimNumber == state.ItemAnimNumber &&
+				data.ItemFrameNumber == state.ItemFrameNumber &&
+				data.EnemyPose == state.EnemyPose &&
+				data.EnemyRoomNumber == state.EnemyRoomNumber &&
+				data.EnemyAnimNumber == state.EnemyAnimNumber &&
+				data.EnemyFrameNumber == state.EnemyFrameNumber &&
+				data.EnemyVelocity == state.EnemyVelocity &&
+				data.EnemyHitPoints == state.EnemyHitPoints &&
+				data.EnemyMoveAngle == state.EnemyMoveAngle &&
+				data.IsEnemyLow == state.IsEnemyLow);
+	}
+
+	static CreatureSenseData SenseCreature(ItemInfo& item)
+	{
+		auto* enemy = GetSenseEnemy(item);
+
+		auto data = CreatureSenseData{};
+		CalculateCreatureAIInfo(&item, enemy, &data.Info, data.BoxNumber, data.EnemyBoxNumber);
+
+		// Same early outs as TargetVisible().
+		if (data.Info.distance < SQUARE(MAX_VISIBILITY_DISTANCE) && enemy->HitPoints != 0)
+		{
+			data.HasVisibility = true;
+			data.IsVisible = TestTargetLos(&item, enemy);
+		}
+
+		SetSenseState(data, item, *enemy);
+		return data;
+	}
+
+	static CreatureSenseData* GetValidCreatureSense(const ItemInfo& item, bool testPathfinding)
+	{
+		if (!IsSensingEnabled || item.Index >= CreatureSenses.size() || !item.IsCreature())
+			return nullptr;
+
+		auto& data = CreatureSenses[item.Index];
+		if (data.Generation != SenseGeneration)
+			return nullptr;
+
+		const auto* enemy = GetCreatureInfo((ItemInfo*)&item)->Enemy;
+		if (enemy == nullptr || !TestSenseState(data, item, *enemy, testPathfinding))
+		{
+			SensingStats.StaleCount++;
+			return nullptr;
+		}
+
+		return &data;
+	}
+
+	void EnableCreatureSensing(bool enable)
+	{
+		IsSensingEnabled = enable;
+	}
+
+	bool IsCreatureSensingEnabled()
+	{
+		return IsSensingEnabled;
+	}
+
+	void SenseCreatures()
+	{
+		if (!IsSensingEnabled)
+			return;
+
+		auto time0 = std::chrono::high_resolution_clock::now();
+
+		SenseGeneration++;
+		if (SenseGeneration == 0)
+			SenseGeneration = 1;
+
+		if (CreatureSenses.size() < g_Level.Items.size())
+			CreatureSenses.resize(g_Level.Items.size());
+
+		SenseItemNumbers.clear();
+		for (const auto* creature : ActiveCreatures)
+		{
+			if (creature->ItemNumber == NO_VALUE)
+				continue;
+
+			const auto& item = g_Level.Items[creature->ItemNumber];
+			if (item.Active && item.IsCreature())
+				SenseItemNumbers.push_back(creature->ItemNumber);
+		}
+
+		// Refresh bridge boxes first, so that probes only read bridge table.
+		UpdateBridgeCache();
+
+		std::for_each(std::execution::par, SenseItemNumbers.begin(), SenseItemNumbers.end(),
+			[](int itemNumber)
+			{
+				SetConcurrentPointCollision(true);
+
+				auto data = SenseCreature(g_Level.Items[itemNumber]);
+				data.Generation = SenseGeneration;
+				CreatureSenses[itemNumber] = data;
+
+				SetConcurrentPointCollision(false);
+			});
+
+		auto time1 = std::chrono::high_resolution_clock::now();
+		SensingStats.CreatureCount += (unsigned int)SenseItemNumbers.size();
+		SensingStats.SenseTime += std::chrono::duration<double, std::micro>(time1 - time0).count();
+	}
+
+	bool ConsumeCreatureSense(const ItemInfo& item, AI_INFO& ai, int& boxNumber, int& enemyBoxNumber)
+	{
+		auto* data = GetValidCreatureSense(item, true);
+		if (data == nullptr || data->IsInfoConsumed)
+			return false;
+
+		// NOTE: Control routine may update pathfinding after reading AI info, so info is only used once per loop.
+		data->IsInfoConsumed = true;
+		SensingStats.ReuseCount++;
+
+		ai = data->Info;
+		boxNumber = data->BoxNumber;
+		enemyBoxNumber = data->EnemyBoxNumber;
+		return true;
+	}
+
+	std::optional<bool> GetSensedTargetVisibility(const ItemInfo& item)
+	{
+		const auto* data = GetValidCreatureSense(item, false);
+		if (data == nullptr || !data->HasVisibility)
+			return std::nullopt;
+
+		return data->IsVisible;
+	}
+
+	void AddCreatureControlTime(double time)
+	{
+		SensingStats.ControlTime += time;
+	}
+
+	void UpdateCreatureSensingStats()
+	{
+		SensingLastStats = SensingStats;
+		SensingStats = {};
+	}
+
+	CreatureSensingStats GetCreatureSensingStats()
+	{
+		return SensingLastStats;
+	}
+}
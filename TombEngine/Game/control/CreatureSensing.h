@@ -0,0 +1,27 @@
+#pragma once
+
+struct AI_INFO;
+struct ItemInfo;
+
+namespace TEN::Control::Sensing
+{
+	struct CreatureSensingStats
+	{
+		unsigned int CreatureCount = 0;	  // Creatures sensed in parallel phase.
+		unsigned int ReuseCount	   = 0;	  // Sensed results used by creature control routines.
+		unsigned int StaleCount	   = 0;	  // Sensed results discarded because creature or its enemy changed before use.
+		double		 SenseTime	   = 0.0; // In microseconds.
+		double		 ControlTime   = 0.0; // Creature control routines, in microseconds.
+	};
+
+	void EnableCreatureSensing(bool enable);
+	bool IsCreatureSensingEnabled();
+
+	void SenseCreatures();
+	bool ConsumeCreatureSense(const ItemInfo& item, AI_INFO& ai, int& boxNumber, int& enemyBoxNumber);
+	std::optional<bool> GetSensedTargetVisibility(const ItemInfo& item);
+
+	void AddCreatureControlTime(double time);
+	void UpdateCreatureSensingStats();
+	CreatureSensingStats GetCreatureSensingStats();
+}
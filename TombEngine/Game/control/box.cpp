@@ -6,6 +6,8 @@
 #include "Game/collision/collide_room.h"
 #include "Game/collision/Point.h"
 #include "Game/control/control.h"
+#include "Game/control/CreatureScheduler.h"
+#include "Game/control/CreatureSensing.h"
 #include "Game/control/lot.h"
 #include "Game/effects/smoke.h"
 #include "Game/effects/tomb4fx.h"
@@ -23,6 +25,8 @@
 
 using namespace TEN::Collision::Point;
 using namespace TEN::Collision::Room;
+using namespace TEN::Control::Scheduler;
+using namespace TEN::Control::Sensing;
 using namespace TEN::Effects::Smoke;
 
 constexpr auto ESCAPE_DIST = BLOCK(5);
@@ -39,15 +43,6 @@ constexpr auto CREATURE_JOINT_ROTATION_MAX = ANGLE(70.0f);
 
 constexpr auto CREATURE_GUN_EFFECT_VERTICAL_OFFSET = 75;
 
-#ifdef CREATURE_AI_PRIORITY_OPTIMIZATION
-constexpr int HIGH_PRIO_RANGE = 8;
-constexpr int MEDIUM_PRIO_RANGE = HIGH_PRIO_RANGE + HIGH_PRIO_RANGE * (HIGH_PRIO_RANGE / 6.0f);
-constexpr int LOW_PRIO_RANGE = MEDIUM_PRIO_RANGE + MEDIUM_PRIO_RANGE * (MEDIUM_PRIO_RANGE / 24.0f);
-constexpr int NONE_PRIO_RANGE = LOW_PRIO_RANGE + LOW_PRIO_RANGE * (LOW_PRIO_RANGE / 32.0f);
-constexpr auto FRAME_PRIO_BASE = 4;
-constexpr auto FRAME_PRIO_EXP = 1.5;
-#endif // CREATURE_AI_PRIORITY_OPTIMIZATION
-
 void DrawBox(int boxIndex, Vector3 color)
 {
 	if (boxIndex == NO_VALUE)
@@ -1081,26 +1076,6 @@ bool SearchLOT(LOTInfo* LOT, int depth)
 	return true;
 }
 
-#if CREATURE_AI_PRIORITY_OPTIMIZATION
-CreatureAIPriority GetCreatureLOTPriority(ItemInfo* item)
-{
-	auto itemPos = item->Pose.Position.ToVector3();
-	auto cameraPos = Camera.pos.ToVector3();
-
-	float distance = Vector3::Distance(itemPos, cameraPos) / BLOCK(1);
-	if (distance <= HIGH_PRIO_RANGE)
-		return CreatureAIPriority::High;
-
-	if (distance <= MEDIUM_PRIO_RANGE)
-		return CreatureAIPriority::Medium;
-
-	if (distance <= LOW_PRIO_RANGE)
-		return CreatureAIPriority::Low;
-
-	return CreatureAIPriority::None;
-}
-#endif
-
 bool CreatureActive(short itemNumber)
 {
 	auto* item = &g_Level.Items[itemNumber];
@@ -1122,11 +1097,6 @@ bool CreatureActive(short itemNumber)
 		item->Status = ITEM_ACTIVE;
 	}
 
-#ifdef CREATURE_AI_PRIORITY_OPTIMIZATION
-	auto* creature = GetCreatureInfo(item);
-	creature->Priority = GetCreatureLOTPriority(item);
-#endif // CREATURE_AI_PRIORITY_OPTIMIZATION
-
 	return true;
 }
 
@@ -1482,6 +1452,7 @@ void FindAITargetObject(CreatureInfo* creature, int objectNumber, int ocb, bool
 	creature->Enemy = &aiItem;
 
 	aiItem.ObjectNumber = foundObject->objectNumber;
+	UpdateItemObjectIndex(aiItem.Index);
 	aiItem.RoomNumber = foundObject->roomNumber;
 	aiItem.Pose.Position = foundObject->pos.Position;
 	aiItem.Pose.Orientation.y = foundObject->pos.Orientation.y;
@@ -1525,39 +1496,29 @@ int TargetReachable(ItemInfo* item, ItemInfo* enemy)
 	return (isReachable ? floor->PathfindingBoxID : NO_VALUE);
 }
 
-void CreatureAIInfo(ItemInfo* item, AI_INFO* AI)
+// Only reads world state, so it's also used by parallel sensing phase. Box numbers are returned instead of written to items.
+void CalculateCreatureAIInfo(ItemInfo* item, ItemInfo* enemy, AI_INFO* AI, int& boxNumber, int& enemyBoxNumber)
 {
-	if (!item->IsCreature())
-		return;
-
 	auto* object = &Objects[item->ObjectNumber];
 	auto* creature = GetCreatureInfo(item);
-	auto* enemy = creature->Enemy;
-
-	// TODO: Deal with LaraItem global.
-	if (enemy == nullptr)
-	{
-		enemy = LaraItem;
-		creature->Enemy = LaraItem;
-	}
 
 	auto* zone = g_Level.Zones[(int)creature->LOT.Zone][(int)FlipStatus].data();
 	auto* room = &g_Level.Rooms[item->RoomNumber];
 
-	item->BoxNumber = GetSector(room, item->Pose.Position.x - room->Position.x, item->Pose.Position.z - room->Position.z)->PathfindingBoxID;
-	AI->zoneNumber = zone[item->BoxNumber];
+	boxNumber = GetSector(room, item->Pose.Position.x - room->Position.x, item->Pose.Position.z - room->Position.z)->PathfindingBoxID;
+	AI->zoneNumber = zone[boxNumber];
 
-	enemy->BoxNumber = TargetReachable(item, enemy);
-	AI->enemyZone = enemy->BoxNumber == NO_VALUE ? NO_VALUE : zone[enemy->BoxNumber];
+	enemyBoxNumber = TargetReachable(item, enemy);
+	AI->enemyZone = enemyBoxNumber == NO_VALUE ? NO_VALUE : zone[enemyBoxNumber];
 
 	if (!object->nonLot)
 	{
-		if (enemy->BoxNumber != NO_VALUE && g_Level.PathfindingBoxes[enemy->BoxNumber].flags & creature->LOT.BlockMask)
+		if (enemyBoxNumber != NO_VALUE && g_Level.PathfindingBoxes[enemyBoxNumber].flags & creature->LOT.BlockMask)
 		{
 			AI->enemyZone |= BLOCKED;
 		}
-		else if (item->BoxNumber != NO_VALUE && 
-			creature->LOT.Node[item->BoxNumber].searchNumber == (creature->LOT.SearchNumber | BLOCKED_SEARCH))
+		else if (boxNumber != NO_VALUE && 
+			creature->LOT.Node[boxNumber].searchNumber == (creature->LOT.SearchNumber | BLOCKED_SEARCH))
 		{
 			AI->enemyZone |= BLOCKED;
 		}
@@ -1587,14 +1548,9 @@ void CreatureAIInfo(ItemInfo* item, AI_INFO* AI)
 	}
 	else
 	{
-		if (creature->Enemy != nullptr)
-		{
-			// TODO: distance is squared, verticalDistance is not. Desquare distance later. -- Lwmte, 27.06.22
-			AI->distance = SQUARE(vector.z) + SQUARE(vector.x); // 2D distance.
-			AI->verticalDistance = vector.y;
-		}
-		else
-			AI->distance = AI->verticalDistance = INT_MAX;
+		// TODO: distance is squared, verticalDistance is not. Desquare distance later. -- Lwmte, 27.06.22
+		AI->distance = SQUARE(vector.z) + SQUARE(vector.x); // 2D distance.
+		AI->verticalDistance = vector.y;
 	}
 
 	AI->angle = angle - item->Pose.Orientation.y;
@@ -1619,6 +1575,66 @@ void CreatureAIInfo(ItemInfo* item, AI_INFO* AI)
 	AI->bite = (AI->ahead && enemy->HitPoints > 0 && abs(enemy->Pose.Position.y - item->Pose.Position.y) <= CLICK(2));
 }
 
+void CreatureAIInfo(ItemInfo* item, AI_INFO* AI)
+{
+	if (!item->IsCreature())
+		return;
+
+	auto* creature = GetCreatureInfo(item);
+
+	// TODO: Deal with LaraItem global.
+	if (creature->Enemy == nullptr)
+		creature->Enemy = LaraItem;
+
+	auto* enemy = creature->Enemy;
+
+	// Reuse result of sensing phase if creature and enemy are unchanged since it ran.
+	int boxNumber = NO_VALUE;
+	int enemyBoxNumber = NO_VALUE;
+	if (!ConsumeCreatureSense(*item, *AI, boxNumber, enemyBoxNumber))
+		CalculateCreatureAIInfo(item, enemy, AI, boxNumber, enemyBoxNumber);
+
+	item->BoxNumber = boxNumber;
+	enemy->BoxNumber = enemyBoxNumber;
+}
+
+static void UpdateCreaturePathAhead(ItemInfo* item)
+{
+	auto* creature = GetCreatureInfo(item);
+
+	creature->JumpAhead = false;
+	creature->MonkeySwingAhead = false;
+
+	if (item->BoxNumber != NO_VALUE)
+	{
+		int endBox = creature->LOT.Node[item->BoxNumber].exitBox;
+		if (endBox != NO_VALUE)
+		{
+			int overlapIndex = g_Level.PathfindingBoxes[item->BoxNumber].overlapIndex;
+			int nextBox = 0;
+			int flags = 0;
+
+			if (overlapIndex >= 0)
+			{
+				do
+				{
+					nextBox = g_Level.Overlaps[overlapIndex].box;
+					flags = g_Level.Overlaps[overlapIndex++].flags;
+				} while (nextBox != NO_VALUE && ((flags & BOX_END_BIT) == false) && (nextBox != endBox));
+			}
+
+			if (nextBox == endBox)
+			{
+				if (flags & BOX_JUMP)
+					creature->JumpAhead = true;
+
+				if (flags & BOX_MONKEY)
+					creature->MonkeySwingAhead = true;
+			}
+		}
+	}
+}
+
 void CreatureMood(ItemInfo* item, AI_INFO* AI, bool isViolent)
 {
 	if (!item->IsCreature())
@@ -1631,6 +1647,15 @@ void CreatureMood(ItemInfo* item, AI_INFO* AI, bool isViolent)
 	if (enemy == nullptr)
 		return;
 
+#ifdef CREATURE_AI_PRIORITY_OPTIMIZATION
+	// Far or unseen creatures keep their target between scheduled AI updates.
+	if (!TestCreatureAIUpdate(*item))
+	{
+		UpdateCreaturePathAhead(item);
+		return;
+	}
+#endif // CREATURE_AI_PRIORITY_OPTIMIZATION
+
 	int boxNumber;
 	switch (creature->Mood)
 	{
@@ -1706,75 +1731,8 @@ void CreatureMood(ItemInfo* item, AI_INFO* AI, bool isViolent)
 	if (LOT->TargetBox == NO_VALUE)
 		TargetBox(LOT, item->BoxNumber);
 
-#ifdef CREATURE_AI_PRIORITY_OPTIMIZATION
-	bool shouldUpdateTarget = false;
-
-	switch(creature->Priority)
-	{
-		case CreatureAIPriority::High:
-			shouldUpdateTarget = true;
-			break;
-
-		case CreatureAIPriority::Medium:
-			if (creature->FramesSinceLOTUpdate > std::pow(FRAME_PRIO_BASE, FRAME_PRIO_EXP))
-				shouldUpdateTarget = true;
-
-			break;
-
-		case CreatureAIPriority::Low:
-			if (creature->FramesSinceLOTUpdate > std::pow(FRAME_PRIO_BASE, FRAME_PRIO_EXP * 2))
-				shouldUpdateTarget = true;
-
-			break;
-
-		default:
-			break;
-	}
-
-	if (shouldUpdateTarget)
-	{
-		CalculateTarget(&creature->Target, item, &creature->LOT);
-		creature->FramesSinceLOTUpdate = 0;
-	}
-	else
-	{
-		creature->FramesSinceLOTUpdate++;
-	}
-#else
 	CalculateTarget(&creature->Target, item, &creature->LOT);
-#endif // CREATURE_AI_PRIORITY_OPTIMIZATION
-
-	creature->JumpAhead = false;
-	creature->MonkeySwingAhead = false;
-
-	if (item->BoxNumber != NO_VALUE)
-	{
-		int endBox = LOT->Node[item->BoxNumber].exitBox;
-		if (endBox != NO_VALUE)
-		{
-			int overlapIndex = g_Level.PathfindingBoxes[item->BoxNumber].overlapIndex;
-			int nextBox = 0;
-			int flags = 0;
-
-			if (overlapIndex >= 0)
-			{
-				do
-				{
-					nextBox = g_Level.Overlaps[overlapIndex].box;
-					flags = g_Level.Overlaps[overlapIndex++].flags;
-				} while (nextBox != NO_VALUE && ((flags & BOX_END_BIT) == false) && (nextBox != endBox));
-			}
-
-			if (nextBox == endBox)
-			{
-				if (flags & BOX_JUMP)
-					creature->JumpAhead = true;
-
-				if (flags & BOX_MONKEY)
-					creature->MonkeySwingAhead = true;
-			}
-		}
-	}
+	UpdateCreaturePathAhead(item);
 }
 
 void GetCreatureMood(ItemInfo* item, AI_INFO* AI, bool isViolent)
@@ -1786,6 +1744,12 @@ void GetCreatureMood(ItemInfo* item, AI_INFO* AI, bool isViolent)
 	auto* enemy = creature->Enemy;
 	auto* LOT = &creature->LOT;
 
+#ifdef CREATURE_AI_PRIORITY_OPTIMIZATION
+	// Far or unseen creatures keep their mood between scheduled AI updates.
+	if (!TestCreatureAIUpdate(*item))
+		return;
+#endif // CREATURE_AI_PRIORITY_OPTIMIZATION
+
 	if (item->BoxNumber == NO_VALUE || creature->LOT.Node[item->BoxNumber].searchNumber == (creature->LOT.SearchNumber | BLOCKED_SEARCH))
 		creature->LOT.RequiredBox = NO_VALUE;
 
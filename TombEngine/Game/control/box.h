@@ -111,6 +111,7 @@ bool SearchLOT(LOTInfo* LOT, int expansion);
 bool CreatureActive(short itemNumber);
 void InitializeCreature(short itemNumber);
 bool StalkBox(ItemInfo* item, ItemInfo* enemy, int boxNumber);
+void CalculateCreatureAIInfo(ItemInfo* item, ItemInfo* enemy, AI_INFO* AI, int& boxNumber, int& enemyBoxNumber);
 void CreatureAIInfo(ItemInfo* item, AI_INFO* AI);
 TARGET_TYPE CalculateTarget(Vector3i* target, ItemInfo* item, LOTInfo* LOT);
 bool CreatureAnimation(short itemNumber, short headingAngle, short tiltAngle);
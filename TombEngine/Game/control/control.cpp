@@ -2,13 +2,19 @@
 #include "Game/control/control.h"
 
 #include <chrono>
+#include <fstream>
 #include <process.h>
 
 #include "Game/camera.h"
 #include "Game/collision/collide_room.h"
+#include "Game/collision/Point.h"
+#include "Game/collision/Sphere.h"
+#include "Game/control/CreatureScheduler.h"
+#include "Game/control/CreatureSensing.h"
 #include "Game/control/flipeffect.h"
 #include "Game/control/lot.h"
 #include "Game/control/volume.h"
+#include "Game/Debug/Benchmark.h"
 #include "Game/effects/debris.h"
 #include "Game/effects/Blood.h"
 #include "Game/effects/Bubble.h"
@@ -57,6 +63,7 @@
 #include "Sound/sound.h"
 #include "Specific/clock.h"
 #include "Specific/Input/Input.h"
+#include "Specific/Input/InputRecording.h"
 #include "Specific/level.h"
 #include "Specific/winmain.h"
 #include "Game/Lara/lara_initialise.h"
@@ -82,6 +89,10 @@ using namespace TEN::Entities::Switches;
 using namespace TEN::Entities::Traps;
 using namespace TEN::Entities::TR4;
 using namespace TEN::Collision::Floordata;
+using namespace TEN::Collision::Point;
+using namespace TEN::Collision::Sphere;
+using namespace TEN::Control::Scheduler;
+using namespace TEN::Control::Sensing;
 using namespace TEN::Control::Volumes;
 using namespace TEN::Hud;
 using namespace TEN::Input;
@@ -112,8 +123,22 @@ short NextFxFree;
 
 int ControlPhaseTime;
 
+// Consistency checks run after every headless frame. Keyed by name, so that registering same check again replaces it.
+static auto HeadlessChecks		  = std::map<std::string, std::function<bool()>>{};
+static bool IsHeadlessCheckFailed = false;
+
 int DrawPhase(bool isTitle)
 {
+	// Headless mode uses null renderer and runs free of real-time synchronization.
+	if (HeadlessMode)
+	{
+		g_Renderer.RenderNull();
+		ClearDisplaySprites();
+
+		Camera.numberFrames = LOOP_FRAME_COUNT;
+		return Camera.numberFrames;
+	}
+
 	if (isTitle)
 	{
 		g_Renderer.RenderTitle();
@@ -153,6 +178,12 @@ GameStatus ControlPhase(int numFrames)
 
 	for (framesCount += numFrames; framesCount > 0; framesCount -= LOOP_FRAME_COUNT)
 	{
+		// Drop point collision probes cached during previous frame.
+		UpdatePointCollisionCache();
+		UpdateItemSphereCache();
+		UpdateCreatureSensingStats();
+		UpdateCreatureLodStats();
+
 		// Controls are polled before OnLoop, so input data could be
 		// overwritten by script API methods.
 		HandleControls(isTitle);
@@ -300,6 +331,17 @@ GameStatus DoLevel(int levelIndex, bool loadGame)
 	if (!LoadLevelFile(levelIndex))
 		return isTitle ? GameStatus::ExitGame : GameStatus::ExitToTitle;
 
+	// Drop point collision probes cached in previous level.
+	InvalidatePointCollisionCache();
+
+	// Use fixed random seed in headless mode to make simulation runs reproducible.
+	if (HeadlessMode)
+		Random::SetSeed(HEADLESS_RANDOM_SEED);
+
+	// Start input recording or replay on first played level (if applicable). Seeds random generator from recording.
+	if (!isTitle)
+		StartInputRecording();
+
 	// Initialize items, effects, lots, and cameras.
 	HairEffect.Initialize();
 	InitializeFXArray();
@@ -317,6 +359,10 @@ GameStatus DoLevel(int levelIndex, bool loadGame)
 	// Initialize game variables and optionally load game.
 	InitializeOrLoadGame(loadGame);
 
+	// Run benchmarks on loaded level (if applicable).
+	if (BenchmarkMode && !isTitle)
+		RunBenchmarks();
+
 	// DoGameLoop() returns only when level has ended.
 	return DoGameLoop(levelIndex);
 }
@@ -543,6 +589,58 @@ void InitializeOrLoadGame(bool loadGame)
 	}
 }
 
+void RegisterHeadlessCheck(const std::string& name, const std::function<bool()>& check)
+{
+	HeadlessChecks[name] = check;
+}
+
+bool HasHeadlessCheckFailed()
+{
+	return IsHeadlessCheckFailed;
+}
+
+static void RunHeadlessChecks(int frame)
+{
+	// Report first failure only.
+	if (IsHeadlessCheckFailed)
+		return;
+
+	for (const auto& [name, check] : HeadlessChecks)
+	{
+		if (check())
+			continue;
+
+		TENLog("Headless check " + name + " failed at frame " + std::to_string(frame) + ".", LogLevel::Error);
+		IsHeadlessCheckFailed = true;
+	}
+}
+
+static void LogHeadlessSimulation(const std::vector<double>& frameTimes)
+{
+	if (frameTimes.empty())
+		return;
+
+	double totalTime = 0.0;
+	for (double frameTime : frameTimes)
+		totalTime += frameTime;
+
+	auto minMax = std::minmax_element(frameTimes.begin(), frameTimes.end());
+	TENLog("Headless simulation: " + std::to_string(frameTimes.size()) + " frames, min " + std::to_string(*minMax.first / 1000.0) +
+		   " us, max " + std::to_string(*minMax.second / 1000.0) + " us.", LogLevel::Info);
+
+	auto results = std::vector<BenchmarkResult>{ BenchmarkResult{ "ControlPhase", (unsigned int)frameTimes.size(), totalTime / frameTimes.size() } };
+	WriteBenchmarkResults(results, "Simulation.json");
+
+	// Write per-frame timings to allow comparing replays of same input recording across builds.
+	auto file = std::ofstream(g_GameFlow->GetGameDir() + "Logs/SimulationFrames.csv", std::ios::out | std::ios::trunc);
+	if (file.is_open())
+	{
+		file << "frame,ns" << std::endl;
+		for (int i = 0; i < frameTimes.size(); i++)
+			file << i << "," << (long long)frameTimes[i] << std::endl;
+	}
+}
+
 GameStatus DoGameLoop(int levelIndex)
 {
 	int numFrames = LOOP_FRAME_COUNT;
@@ -552,10 +650,31 @@ GameStatus DoGameLoop(int levelIndex)
 	// called once to sort out various runtime shenanigangs (e.g. hair).
 	status = ControlPhase(numFrames);
 
+	auto headlessFrameTimes = std::vector<double>{};
+	if (HeadlessMode)
+		headlessFrameTimes.reserve(HeadlessFrameCount);
+
 	while (DoTheGame)
 	{
+		auto frameStartTime = std::chrono::high_resolution_clock::now();
 		status = ControlPhase(numFrames);
 
+		// Stop headless simulation after requested number of frames.
+		if (HeadlessMode)
+		{
+			auto frameTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - frameStartTime);
+			headlessFrameTimes.push_back((double)frameTime.count());
+
+			RunHeadlessChecks((int)headlessFrameTimes.size());
+
+			if ((int)headlessFrameTimes.size() >= HeadlessFrameCount || IsInputReplayFinished())
+			{
+				LogHeadlessSimulation(headlessFrameTimes);
+				status = GameStatus::ExitGame;
+				break;
+			}
+		}
+
 		if (!levelIndex)
 		{
 			UpdateInputActions(LaraItem);
@@ -608,6 +727,7 @@ void EndGameLoop(int levelIndex, GameStatus reason)
 {
 	SaveGame::SaveHub(levelIndex);
 	DeInitializeScripting(levelIndex, reason);
+	StopInputRecording();
 
 	StopAllSounds();
 	StopSoundTracks();
@@ -85,6 +85,9 @@ GameStatus DoLevel(int levelIndex, bool loadGame = false);
 GameStatus DoGameLoop(int levelIndex);
 void EndGameLoop(int levelIndex, GameStatus reason);
 
+void RegisterHeadlessCheck(const std::string& name, const std::function<bool()>& check);
+bool HasHeadlessCheckFailed();
+
 GameStatus HandleMenuCalls(bool isTitle);
 GameStatus HandleGlobalInputEvents(bool isTitle);
 void HandleControls(bool isTitle);
@@ -23,12 +23,9 @@ using namespace TEN::Collision::Sphere;
 using namespace TEN::Math;
 using TEN::Renderer::g_Renderer;
 
-// Globals
-int NumberLosRooms;
-int LosRooms[20];
-int ClosestItem;
-int ClosestDist;
-Vector3i ClosestCoord;
+// NOTE: Thread-local, as LOS may be tested from creature sensing workers.
+static thread_local int NumberLosRooms;
+static thread_local int LosRooms[20];
 
 static int xLOS(const GameVector& origin, GameVector& target)
 {
@@ -247,16 +244,10 @@ bool LOS(const GameVector* origin, GameVector* target)
 	return false;
 }
 
-bool GetTargetOnLOS(GameVector* origin, GameVector* target, bool drawTarget, bool isFiring)
+// Responds to fired or aimed ray once its room geometry and object hits are known.
+static bool HandleTargetOnLos(GameVector* origin, GameVector& target2, bool isClear, int itemNumber, const Vector3i& vector, MESH_INFO* mesh,
+							  const Vector3& dir, bool drawTarget, bool isFiring)
 {
-	auto dir = target->ToVector3() - origin->ToVector3();
-	dir.Normalize();
-
-	auto target2 = *target;
-	int result = LOS(origin, &target2);
-
-	GetFloor(target2.x, target2.y, target2.z, &target2.RoomNumber);
-
 	if (isFiring && Lara.Control.Look.IsUsingLasersight)
 	{
 		Lara.Control.Weapon.HasFired = true;
@@ -268,10 +259,6 @@ bool GetTargetOnLOS(GameVector* origin, GameVector* target, bool drawTarget, boo
 
 	bool hasHit = false;
 
-	MESH_INFO* mesh = nullptr;
-	auto vector = Vector3i::Zero;
-	int itemNumber = ObjectOnLOS2(origin, target, &vector, &mesh);
-
 	if (itemNumber != NO_LOS_ITEM)
 	{
 		target2.x = vector.x - ((vector.x - origin->x) >> 5);
@@ -325,7 +312,7 @@ bool GetTargetOnLOS(GameVector* origin, GameVector* target, bool drawTarget, boo
 								{
 									const auto& weapon = Weapons[(int)Lara.Control.Weapon.GunType];
 
-									auto spheres = item->GetSpheres();
+									const auto& spheres = item->GetSpheres();
 									auto ray = Ray(origin->ToVector3(), dir);
 									float bestDistance = INFINITY;
 									int bestJointIndex = NO_VALUE;
@@ -446,12 +433,12 @@ bool GetTargetOnLOS(GameVector* origin, GameVector* target, bool drawTarget, boo
 			target2.y -= (target2.y - origin->y) >> 5;
 			target2.z -= (target2.z - origin->z) >> 5;
 
-			if (isFiring && !result)
+			if (isFiring && !isClear)
 				TriggerRicochetSpark(target2, LaraItem->Pose.Orientation.y, 8, 0);
 		}
 	}
 
-	if (drawTarget && (hasHit || !result))
+	if (drawTarget && (hasHit || !isClear))
 	{
 		TriggerDynamicLight(target2.x, target2.y, target2.z, 64, 255, 0, 0);
 		LaserSightActive = 1;
@@ -463,165 +450,353 @@ bool GetTargetOnLOS(GameVector* origin, GameVector* target, bool drawTarget, boo
 	return hasHit;
 }
 
-static bool DoRayBox(const GameVector& origin, const GameVector& target, const GameBoundingBox& bounds,
-					 const Pose& objectPose, Vector3i& hitPos, int closestItemNumber)
+bool GetTargetOnLOS(GameVector* origin, GameVector* target, bool drawTarget, bool isFiring)
 {
-	auto box = bounds.ToBoundingOrientedBox(objectPose);
+	auto dir = target->ToVector3() - origin->ToVector3();
+	dir.Normalize();
 
-	auto rayOrigin = origin.ToVector3();
-	auto rayDir = (target - origin).ToVector3();
-	rayDir.Normalize();
+	auto target2 = *target;
+	bool isClear = LOS(origin, &target2);
 
-	// Don't test spheres if no intersection.
-	float dist = 0.0f;
-	if (rayDir == Vector3::Zero || !box.Intersects(rayOrigin, rayDir, dist))
+	GetFloor(target2.x, target2.y, target2.z, &target2.RoomNumber);
+
+	MESH_INFO* mesh = nullptr;
+	auto vector = Vector3i::Zero;
+	int itemNumber = ObjectOnLOS2(origin, target, &vector, &mesh);
+
+	return HandleTargetOnLos(origin, target2, isClear, itemNumber, vector, mesh, dir, drawTarget, isFiring);
+}
+
+// Earlier rays of same batch may have shattered or smashed object which was hit.
+static bool IsLosRayHitValid(const LosRay& ray)
+{
+	if (ray.ObjectIndex == NO_LOS_ITEM)
+		return true;
+
+	if (ray.ObjectIndex < 0)
+		return (ray.StaticPtr != nullptr && (ray.StaticPtr->flags & StaticMeshFlags::SM_VISIBLE));
+
+	const auto& item = g_Level.Items[ray.ObjectIndex];
+	if (item.Status == ITEM_DEACTIVATED || item.Status == ITEM_INVISIBLE)
 		return false;
 
-	// Get raw collision point.
-	auto collidedPoint = Geometry::TranslatePoint(rayOrigin, rayDir, dist);
-	hitPos.x = collidedPoint.x - objectPose.Position.x;
-	hitPos.y = collidedPoint.y - objectPose.Position.y;
-	hitPos.z = collidedPoint.z - objectPose.Position.z;
+	return (ray.SphereIndex == NO_VALUE || (item.MeshBits & (1 << ray.SphereIndex)));
+}
+
+static void SetShatterItem(const ItemInfo& item, int sphereIndex, const BoundingSphere& sphere)
+{
+	ShatterItem.yRot = item.Pose.Orientation.y;
+	ShatterItem.meshIndex = Objects[item.ObjectNumber].meshIndex + sphereIndex;
+	ShatterItem.color = item.Model.Color;
+	ShatterItem.sphere.Center = sphere.Center;
+	ShatterItem.bit = 1 << sphereIndex;
+	ShatterItem.flags = 0;
+}
 
-	// Test single spheres in case of items.
-	int meshIndex = 0;
-	int bit = 0;
-	int sp = -2;
-	float minDist = INFINITY;
+// Same as above, but uses ray result from GetLosBatch(). Ray is tested again if its hit became stale.
+bool GetTargetOnLOS(LosRay& ray, bool drawTarget, bool isFiring)
+{
+	if (!IsLosRayHitValid(ray))
+		GetLos(ray, true);
 
-	if (closestItemNumber < 0)
+	if (ray.SphereIndex != NO_VALUE)
 	{
-		// Static meshes don't require further tests.
-		sp = -1;
-		minDist = dist;
+		const auto& item = g_Level.Items[ray.ObjectIndex];
+		SetShatterItem(item, ray.SphereIndex, item.GetSpheres()[ray.SphereIndex]);
 	}
-	else
+
+	auto dir = ray.Target.ToVector3() - ray.Origin.ToVector3();
+	dir.Normalize();
+
+	auto target2 = ray.ClippedTarget;
+	GetFloor(target2.x, target2.y, target2.z, &target2.RoomNumber);
+
+	return HandleTargetOnLos(&ray.Origin, target2, ray.IsClear, ray.ObjectIndex, ray.HitPos, ray.StaticPtr, dir, drawTarget, isFiring);
+}
+
+// Object candidate gathered once per query from traversed rooms.
+// Enclosing sphere serves as broadphase before oriented box and item sphere tests.
+struct LosCandidate
+{
+	int					ObjectIndex = NO_LOS_ITEM; // Item number, or -1 - static number for statics.
+	int					RoomNumber	= NO_VALUE;
+	MESH_INFO*			StaticPtr	= nullptr;
+	Vector3i			Position	= Vector3i::Zero;
+	BoundingOrientedBox Box			= {};
+	BoundingSphere		Sphere		= {};
+
+	const std::vector<BoundingSphere>* Spheres = nullptr; // Item joint spheres, fetched on first box hit.
+};
+
+struct LosHit
+{
+	int		   ObjectIndex	= NO_LOS_ITEM;
+	float	   Distance		= 0.0f;
+	Vector3i   Position		= Vector3i::Zero;
+	int		   RoomNumber	= NO_VALUE;
+	MESH_INFO* StaticPtr	= nullptr; // Last static which was closest at time of test.
+	int		   SphereIndex	= NO_VALUE;
+	int		   CandidateID	= NO_VALUE;
+};
+
+// NOTE: Thread-local for same reason as traversed room list.
+static thread_local auto LosCandidates		   = std::vector<LosCandidate>{};
+static thread_local auto LosBatchRoomNumbers   = std::vector<int>{};			  // Rooms traversed by any ray of batch.
+static thread_local auto LosBatchRoomRanges	   = std::vector<std::pair<int, int>>{}; // Candidate start and count per batch room.
+static thread_local auto LosBatchRayRoomNumbers = std::vector<int>{};			  // Rooms traversed by each ray, back to back.
+
+static void AddLosCandidates(int roomNumber, bool testStatics, GAME_OBJECT_ID priorityObjectID)
+{
+	auto addCandidate = [](int objectIndex, int roomNumber, MESH_INFO* staticPtr, const GameBoundingBox& bounds, const Pose& pose)
+	{
+		auto& candidate = LosCandidates.emplace_back();
+		candidate.ObjectIndex = objectIndex;
+		candidate.RoomNumber = roomNumber;
+		candidate.StaticPtr = staticPtr;
+		candidate.Position = pose.Position;
+		candidate.Box = bounds.ToBoundingOrientedBox(pose);
+		candidate.Sphere = BoundingSphere(candidate.Box.Center, Vector3(candidate.Box.Extents).Length());
+	};
+
+	auto& room = g_Level.Rooms[roomNumber];
+
+	if (testStatics)
+	{
+		for (auto& staticObj : room.mesh)
+		{
+			if (!(staticObj.flags & StaticMeshFlags::SM_VISIBLE))
+				continue;
+
+			auto pose = Pose(staticObj.pos.Position, EulerAngles(0, staticObj.pos.Orientation.y, 0));
+			addCandidate(-1 - staticObj.staticNumber, roomNumber, &staticObj, GetBoundsAccurate(staticObj, false), pose);
+		}
+	}
+
+	for (short linkNumber = room.itemNumber; linkNumber != NO_VALUE; linkNumber = g_Level.Items[linkNumber].NextItem)
+	{
+		const auto& item = g_Level.Items[linkNumber];
+
+		if (item.Status == ITEM_DEACTIVATED || item.Status == ITEM_INVISIBLE)
+			continue;
+
+		if (priorityObjectID != GAME_OBJECT_ID::ID_NO_OBJECT && item.ObjectNumber != priorityObjectID)
+			continue;
+
+		if (item.ObjectNumber != ID_LARA && Objects[item.ObjectNumber].collision == nullptr)
+			continue;
+
+		if (item.ObjectNumber == ID_LARA && priorityObjectID != ID_LARA)
+			continue;
+
+		auto pose = Pose(item.Pose.Position, EulerAngles(0, item.Pose.Orientation.y, 0));
+		addCandidate(linkNumber, roomNumber, nullptr, GameBoundingBox(&item), pose);
+	}
+}
+
+static void CollectLosCandidates(const int* roomNumbers, int roomCount, bool testStatics, GAME_OBJECT_ID priorityObjectID)
+{
+	LosCandidates.clear();
+
+	for (int r = 0; r < roomCount; r++)
+		AddLosCandidates(roomNumbers[r], testStatics, priorityObjectID);
+}
+
+static bool DoRayBox(const Vector3& rayOrigin, const Vector3& rayDir, LosCandidate& candidate, LosHit& hit)
+{
+	// Broadphase: skip if enclosing sphere is missed or lies beyond closest hit.
+	float dist = 0.0f;
+	if (!candidate.Sphere.Intersects(rayOrigin, rayDir, dist))
+		return false;
+
+	float distToSphere = Vector3::Distance(rayOrigin, candidate.Sphere.Center) - candidate.Sphere.Radius;
+	if (distToSphere > 0.0f && distToSphere >= hit.Distance)
+		return false;
+
+	// Don't test spheres if no intersection.
+	if (!candidate.Box.Intersects(rayOrigin, rayDir, dist))
+		return false;
+
+	// Static meshes don't require further tests.
+	int sphereIndex = NO_VALUE;
+	if (candidate.ObjectIndex >= 0)
 	{
 		// Test spheres instead for items.
-		auto* item = &g_Level.Items[closestItemNumber];
-		auto* object = &Objects[item->ObjectNumber];
+		const auto& item = g_Level.Items[candidate.ObjectIndex];
+		const auto& object = Objects[item.ObjectNumber];
 
-		if (object->nmeshes <= 0)
+		if (object.nmeshes <= 0)
 			return false;
 
-		meshIndex = object->meshIndex;
+		if (candidate.Spheres == nullptr)
+			candidate.Spheres = &item.GetSpheres();
 
-		auto spheres = item->GetSpheres();
-		for (int i = 0; i < object->nmeshes; i++)
+		float minDist = INFINITY;
+		for (int i = 0; i < object.nmeshes; i++)
 		{
 			// If mesh is visible.
-			if (item->MeshBits & (1 << i))
-			{
-				float distance;
-				const auto& sphere = spheres[i];
-
-				if (sphere.Intersects(rayOrigin, rayDir, distance))
-				{
-					// Test for minimum distance.
+			if (!(item.MeshBits & (1 << i)))
+				continue;
 
-					if (distance < minDist)
-					{
-						minDist = distance;
-						meshIndex = object->meshIndex + i;
-						bit = 1 << i;
-						sp = i;
-					}
-				}
+			float distance = 0.0f;
+			if ((*candidate.Spheres)[i].Intersects(rayOrigin, rayDir, distance) && distance < minDist)
+			{
+				minDist = distance;
+				sphereIndex = i;
 			}
 		}
 
-		if (sp < -1)
+		if (sphereIndex == NO_VALUE)
 			return false;
 	}
 
-	if (dist >= ClosestDist)
+	if (dist >= hit.Distance)
 		return false;
 
-	// Set up test result.
-	ClosestCoord.x = hitPos.x + objectPose.Position.x;
-	ClosestCoord.y = hitPos.y + objectPose.Position.y;
-	ClosestCoord.z = hitPos.z + objectPose.Position.z;
-	ClosestDist = dist;
-	ClosestItem = closestItemNumber;
+	// Set up test result. Hit offset is truncated relative to object position.
+	auto collidedPoint = Geometry::TranslatePoint(rayOrigin, rayDir, dist);
+	hit.Position = Vector3i(
+		(int)(collidedPoint.x - candidate.Position.x) + candidate.Position.x,
+		(int)(collidedPoint.y - candidate.Position.y) + candidate.Position.y,
+		(int)(collidedPoint.z - candidate.Position.z) + candidate.Position.z);
+	hit.ObjectIndex = candidate.ObjectIndex;
+	hit.Distance = dist;
+	hit.RoomNumber = candidate.RoomNumber;
+	hit.SphereIndex = sphereIndex;
+
+	if (candidate.StaticPtr != nullptr)
+		hit.StaticPtr = candidate.StaticPtr;
 
-	// If collided object is item, set up shatter item data struct.
-	if (sp >= 0)
+	return true;
+}
+
+static void TestLosCandidateRange(const Vector3& rayOrigin, const Vector3& rayDir, int start, int count, LosHit& hit)
+{
+	for (int i = start; i < (start + count); i++)
 	{
-		auto* item = &g_Level.Items[closestItemNumber];
+		if (DoRayBox(rayOrigin, rayDir, LosCandidates[i], hit))
+			hit.CandidateID = i;
+	}
+}
 
-		auto spheres = item->GetSpheres();
+static LosHit TestLosCandidates(const GameVector& origin, const GameVector& target, float maxDist)
+{
+	auto hit = LosHit{};
+	hit.Distance = maxDist;
+	hit.Position = target.ToVector3i();
 
-		ShatterItem.yRot = item->Pose.Orientation.y;
-		ShatterItem.meshIndex = meshIndex;
-		ShatterItem.color = item->Model.Color;
-		ShatterItem.sphere.Center = spheres[sp].Center;
-		ShatterItem.bit = bit;
-		ShatterItem.flags = 0;
-	}
+	auto rayOrigin = origin.ToVector3();
+	auto rayDir = (target - origin).ToVector3();
+	rayDir.Normalize();
 
-	return true;
+	if (rayDir == Vector3::Zero)
+		return hit;
+
+	TestLosCandidateRange(rayOrigin, rayDir, 0, (int)LosCandidates.size(), hit);
+	return hit;
 }
 
 int ObjectOnLOS2(GameVector* origin, GameVector* target, Vector3i* vec, MESH_INFO** mesh, GAME_OBJECT_ID priorityObjectID)
 {
-	ClosestItem = NO_LOS_ITEM;
-	ClosestDist = SQUARE(target->x - origin->x) + SQUARE(target->y - origin->y) + SQUARE(target->z - origin->z);
+	CollectLosCandidates(LosRooms, NumberLosRooms, mesh != nullptr, priorityObjectID);
 
-	for (int r = 0; r < NumberLosRooms; ++r)
-	{
-		auto& room = g_Level.Rooms[LosRooms[r]];
+	// NOTE: Squared length is historical maximum distance and is kept for compatibility.
+	float maxDist = Vector3(target->ToVector3() - origin->ToVector3()).LengthSquared();
+	auto hit = TestLosCandidates(*origin, *target, maxDist);
 
-		auto pose = Pose::Zero;
+	if (hit.RoomNumber != NO_VALUE)
+		target->RoomNumber = hit.RoomNumber;
 
-		if (mesh)
-		{
-			for (int m = 0; m < room.mesh.size(); m++)
-			{
-				auto& meshp = room.mesh[m];
+	if (mesh != nullptr && hit.StaticPtr != nullptr)
+		*mesh = hit.StaticPtr;
 
-				if (meshp.flags & StaticMeshFlags::SM_VISIBLE)
-				{
-					auto bounds = GetBoundsAccurate(meshp, false);
-					pose = Pose(meshp.pos.Position, EulerAngles(0, meshp.pos.Orientation.y, 0));
+	// If collided object is item, set up shatter item data struct.
+	if (hit.SphereIndex != NO_VALUE)
+	{
+		const auto& candidate = LosCandidates[hit.CandidateID];
+		SetShatterItem(g_Level.Items[hit.ObjectIndex], hit.SphereIndex, (*candidate.Spheres)[hit.SphereIndex]);
+	}
 
-					if (DoRayBox(*origin, *target, bounds, pose, *vec, -1 - meshp.staticNumber))
-					{
-						*mesh = &meshp;
-						target->RoomNumber = LosRooms[r];
-					}
-				}
-			}
-		}
+	*vec = hit.Position;
+	return hit.ObjectIndex;
+}
 
-		for (short linkNumber = room.itemNumber; linkNumber != NO_VALUE; linkNumber = g_Level.Items[linkNumber].NextItem)
+// Drop-in replacement for LOS() followed by ObjectOnLOS2() for several rays. Room geometry is traced per ray, and
+// object candidates of all traversed rooms are gathered once. Each ray is only tested against candidates of rooms it traversed.
+static void GetLosBatch(LosRay* rays, int rayCount, bool testStatics, GAME_OBJECT_ID priorityObjectID)
+{
+	LosBatchRoomNumbers.clear();
+	LosBatchRayRoomNumbers.clear();
+	for (int i = 0; i < rayCount; i++)
+	{
+		auto& ray = rays[i];
+
+		ray.ClippedTarget = ray.Target;
+		ray.IsClear = LOS(&ray.Origin, &ray.ClippedTarget);
+
+		LosBatchRayRoomNumbers.push_back(NumberLosRooms);
+		for (int j = 0; j < NumberLosRooms; j++)
 		{
-			const auto& item = g_Level.Items[linkNumber];
+			LosBatchRayRoomNumbers.push_back(LosRooms[j]);
 
-			if (item.Status == ITEM_DEACTIVATED || item.Status == ITEM_INVISIBLE)
-				continue;
+			if (std::find(LosBatchRoomNumbers.begin(), LosBatchRoomNumbers.end(), LosRooms[j]) == LosBatchRoomNumbers.end())
+				LosBatchRoomNumbers.push_back(LosRooms[j]);
+		}
+	}
 
-			if (priorityObjectID != GAME_OBJECT_ID::ID_NO_OBJECT && item.ObjectNumber != priorityObjectID)
-				continue;
+	LosCandidates.clear();
+	LosBatchRoomRanges.clear();
+	for (int roomNumber : LosBatchRoomNumbers)
+	{
+		int start = (int)LosCandidates.size();
+		AddLosCandidates(roomNumber, testStatics, priorityObjectID);
+		LosBatchRoomRanges.push_back(std::pair(start, (int)LosCandidates.size() - start));
+	}
 
-			if (item.ObjectNumber != ID_LARA && Objects[item.ObjectNumber].collision == nullptr)
-				continue;
+	int rayRoomIndex = 0;
+	for (int i = 0; i < rayCount; i++)
+	{
+		auto& ray = rays[i];
+		int roomCount = LosBatchRayRoomNumbers[rayRoomIndex++];
 
-			if (item.ObjectNumber == ID_LARA && priorityObjectID != ID_LARA)
-				continue;
+		// NOTE: Squared length is historical maximum distance of ObjectOnLOS2() and is kept for compatibility.
+		auto hit = LosHit{};
+		hit.Distance = Vector3(ray.Target.ToVector3() - ray.Origin.ToVector3()).LengthSquared();
+		hit.Position = ray.Target.ToVector3i();
+
+		auto rayOrigin = ray.Origin.ToVector3();
+		auto rayDir = (ray.Target - ray.Origin).ToVector3();
+		rayDir.Normalize();
 
-			auto bounds = GameBoundingBox(&item);
-			pose = Pose(item.Pose.Position, EulerAngles(0, item.Pose.Orientation.y, 0));
+		if (rayDir != Vector3::Zero)
+		{
+			// Test candidates in same room order as ObjectOnLOS2(), so that equidistant hits resolve identically.
+			for (int j = 0; j < roomCount; j++)
+			{
+				int roomNumber = LosBatchRayRoomNumbers[rayRoomIndex + j];
+				int batchRoomIndex = (int)(std::find(LosBatchRoomNumbers.begin(), LosBatchRoomNumbers.end(), roomNumber) - LosBatchRoomNumbers.begin());
 
-			if (DoRayBox(*origin, *target, bounds, pose, *vec, linkNumber))
-				target->RoomNumber = LosRooms[r];
+				const auto& range = LosBatchRoomRanges[batchRoomIndex];
+				TestLosCandidateRange(rayOrigin, rayDir, range.first, range.second, hit);
+			}
 		}
+
+		rayRoomIndex += roomCount;
+
+		ray.ObjectIndex = hit.ObjectIndex;
+		ray.HitPos = hit.Position;
+		ray.StaticPtr = hit.StaticPtr;
+		ray.SphereIndex = hit.SphereIndex;
 	}
+}
 
-	vec->x = ClosestCoord.x;
-	vec->y = ClosestCoord.y;
-	vec->z = ClosestCoord.z;
+void GetLosBatch(std::vector<LosRay>& rays, bool testStatics, GAME_OBJECT_ID priorityObjectID)
+{
+	GetLosBatch(rays.data(), (int)rays.size(), testStatics, priorityObjectID);
+}
 
-	return ClosestItem;
+void GetLos(LosRay& ray, bool testStatics, GAME_OBJECT_ID priorityObjectID)
+{
+	GetLosBatch(&ray, 1, testStatics, priorityObjectID);
 }
 
 bool LOSAndReturnTarget(GameVector* origin, GameVector* target, int push)
@@ -5,10 +5,26 @@
 
 constexpr auto NO_LOS_ITEM = INT_MAX;
 
+struct LosRay
+{
+	GameVector Origin = {};
+	GameVector Target = {};
+
+	bool	   IsClear		 = false;			// Room geometry does not block ray.
+	GameVector ClippedTarget = {};				// Target clipped to room geometry.
+	int		   ObjectIndex	 = NO_LOS_ITEM;		// Closest item number, or -1 - static number for statics.
+	Vector3i   HitPos		 = Vector3i::Zero;
+	MESH_INFO* StaticPtr	 = nullptr;			// NOTE: As with ObjectOnLOS2(), may be set if static was passed by closer item.
+	int		   SphereIndex	 = NO_VALUE;		// Hit item joint sphere.
+};
+
 bool LOS(const GameVector* origin, GameVector* target);
 bool GetTargetOnLOS(GameVector* origin, GameVector* target, bool drawTarget, bool isFiring);
+bool GetTargetOnLOS(LosRay& ray, bool drawTarget, bool isFiring);
 int	 ObjectOnLOS2(GameVector* origin, GameVector* target, Vector3i* vec, MESH_INFO** mesh, GAME_OBJECT_ID priorityObjectID = GAME_OBJECT_ID::ID_NO_OBJECT);
 bool LOSAndReturnTarget(GameVector* origin, GameVector* target, int push);
+void GetLosBatch(std::vector<LosRay>& rays, bool testStatics, GAME_OBJECT_ID priorityObjectID = GAME_OBJECT_ID::ID_NO_OBJECT);
+void GetLos(LosRay& ray, bool testStatics, GAME_OBJECT_ID priorityObjectID = GAME_OBJECT_ID::ID_NO_OBJECT);
 
 std::optional<Vector3> GetStaticObjectLos(const Vector3& origin, int roomNumber, const Vector3& dir, float dist, bool onlySolid);
 std::pair<GameVector, GameVector> GetRayFrom2DPosition(const Vector2& screenPos);
@@ -262,22 +262,18 @@ bool PickupTrigger(short itemNumber)
 	return true;
 }
 
-void RefreshCamera(short type, short* data)
+void RefreshCamera(const TriggerProgram& program)
 {
-	short trigger, value, targetOk;
+	short targetOk = 2;
 
-	targetOk = 2;
-
-	do
+	for (int i = 0; i < program.ActionCount; i++)
 	{
-		trigger = *(data++);
-		value = trigger & VALUE_BITS;
+		const auto& action = GetTriggerAction(program, i);
+		short value = action.Value;
 
-		switch (TRIG_BITS(trigger))
+		switch (action.Type)
 		{
 		case TO_CAMERA:
-			data++;
-
 			if (value == Camera.last)
 			{
 				Camera.number = value;
@@ -303,7 +299,7 @@ void RefreshCamera(short type, short* data)
 			Camera.item = &g_Level.Items[value];
 			break;
 		}
-	} while (!(trigger & END_BIT));
+	}
 
 	if (Camera.item)
 		if (!targetOk || (targetOk == 2 && Camera.item->LookedAt && Camera.item != Camera.lastItem))
@@ -330,6 +326,109 @@ short* GetTriggerIndex(ItemInfo* item)
 	return GetTriggerIndex(floor, item->Pose.Position.x, item->Pose.Position.y, item->Pose.Position.z);
 }
 
+static std::vector<TriggerProgram> TriggerPrograms		= {};
+static std::vector<TriggerAction>  TriggerActions		= {};
+static std::vector<int>			   TriggerProgramIndices = {}; // Program index per floordata offset.
+
+static int CompileTriggerProgram(int triggerIndex)
+{
+	const auto& floorData = g_Level.FloorData;
+	if (triggerIndex < 0 || (triggerIndex + 2) > floorData.size())
+		return NO_VALUE;
+
+	if (TriggerProgramIndices[triggerIndex] != NO_VALUE)
+		return TriggerProgramIndices[triggerIndex];
+
+	const short* data = &floorData[triggerIndex];
+	const short* dataEnd = floorData.data() + floorData.size();
+
+	auto program = TriggerProgram{};
+	program.Type = (TRIGGER_TYPES)((*(data++) >> 8) & TRIGGER_BITS);
+	program.Flags = *(data++);
+	program.Timer = program.Flags & TIMER_BITS;
+
+	if ((program.Type == TRIGGER_TYPES::SWITCH || program.Type == TRIGGER_TYPES::KEY || program.Type == TRIGGER_TYPES::PICKUP) &&
+		data < dataEnd)
+	{
+		program.Value = *(data++) & VALUE_BITS;
+	}
+
+	program.ActionStart = (int)TriggerActions.size();
+
+	short trigger = 0;
+	do
+	{
+		if (data >= dataEnd)
+		{
+			TENLog("Trigger floordata at index " + std::to_string(triggerIndex) + " is not terminated.", LogLevel::Warning);
+			break;
+		}
+
+		trigger = *(data++);
+
+		auto action = TriggerAction{};
+		action.Type = (TRIGOBJECTS_TYPES)((trigger >> 10) & FUNCTION_BITS);
+		action.Value = trigger & VALUE_BITS;
+
+		// These actions are followed by extra word, which also carries end bit.
+		if ((action.Type == TO_CAMERA || action.Type == TO_FLYBY || action.Type == TO_VOLUMEEVENT || action.Type == TO_GLOBALEVENT) &&
+			data < dataEnd)
+		{
+			action.Data =
+			trigger = *(data++);
+		}
+
+		TriggerActions.push_back(action);
+	} while (!(trigger & END_BIT));
+
+	program.ActionCount = (int)TriggerActions.size() - program.ActionStart;
+
+	TriggerProgramIndices[triggerIndex] = (int)TriggerPrograms.size();
+	TriggerPrograms.push_back(program);
+	return TriggerProgramIndices[triggerIndex];
+}
+
+void CompileTriggers()
+{
+	TriggerPrograms.clear();
+	TriggerActions.clear();
+	TriggerProgramIndices.assign(g_Level.FloorData.size(), NO_VALUE);
+
+	// Doors retarget sectors they close to floordata offset 0.
+	CompileTriggerProgram(0);
+
+	for (const auto& room : g_Level.Rooms)
+	{
+		for (const auto& sector : room.Sectors)
+		{
+			if (sector.TriggerIndex != NO_VALUE)
+				CompileTriggerProgram(sector.TriggerIndex);
+		}
+	}
+
+	TENLog("Compiled " + std::to_string(TriggerPrograms.size()) + " trigger programs with " +
+		   std::to_string(TriggerActions.size()) + " actions.", LogLevel::Info);
+}
+
+const TriggerProgram* GetTriggerProgram(int triggerIndex)
+{
+	if (triggerIndex < 0 || triggerIndex >= TriggerProgramIndices.size())
+		return nullptr;
+
+	// NOTE: Programs are only compiled at level load. Compiling on demand could grow program tables during
+	// nested TestTriggers() call and leave outer caller's program pointer dangling.
+	int programIndex = TriggerProgramIndices[triggerIndex];
+	if (programIndex == NO_VALUE)
+		return nullptr;
+
+	return &TriggerPrograms[programIndex];
+}
+
+const TriggerAction& GetTriggerAction(const TriggerProgram& program, int actionIndex)
+{
+	return TriggerActions[program.ActionStart + actionIndex];
+}
+
 void Antitrigger(short const value, short const flags)
 {
 	ItemInfo* item = &g_Level.Items[value];
@@ -408,17 +507,18 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, Activator activator, bo
 	int keyResult = 0;
 	int spotCamIndex = 0;
 
-	auto data = GetTriggerIndex(floor, x, y, z);
+	const auto& bottomSector = GetPointCollision(Vector3i(x, y, z), floor->RoomNumber).GetBottomSector();
+	const auto* program = GetTriggerProgram(bottomSector.TriggerIndex);
 
-	if (!data)
+	if (!program)
 		return;
 
-	short triggerType = (*(data++) >> 8) & TRIGGER_BITS;
-	short flags = *(data++);
-	short timer = flags & TIMER_BITS;
+	short triggerType = program->Type;
+	short flags = program->Flags;
+	short timer = program->Timer;
 
 	if (Camera.type != CameraType::Heavy)
-		RefreshCamera(triggerType, data);
+		RefreshCamera(*program);
 
 	short value = 0;
 
@@ -457,7 +557,7 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, Activator activator, bo
 		switch (triggerType)
 		{
 		case TRIGGER_TYPES::SWITCH:
-			value = *(data++) & VALUE_BITS;
+			value = program->Value;
 
 			if (flags & ONESHOT)
 				g_Level.Items[value].ItemFlags[0] = 1;
@@ -517,14 +617,14 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, Activator activator, bo
 			return;
 
 		case TRIGGER_TYPES::KEY:
-			value = *(data++) & VALUE_BITS;
+			value = program->Value;
 			keyResult = KeyTrigger(value);
 			if (keyResult != -1)
 				break;
 			return;
 
 		case TRIGGER_TYPES::PICKUP:
-			value = *(data++) & VALUE_BITS;
+			value = program->Value;
 			if (!PickupTrigger(value))
 				return;
 			break;
@@ -551,11 +651,12 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, Activator activator, bo
 	ItemInfo* item = nullptr;
 	ItemInfo* cameraItem = nullptr;
 
-	do
+	for (int i = 0; i < program->ActionCount; i++)
 	{
-		trigger = *(data++);
-		value = trigger & VALUE_BITS;
-		targetType = (trigger >> 10) & FUNCTION_BITS;
+		const auto& action = GetTriggerAction(*program, i);
+		trigger = action.Data;
+		value = action.Value;
+		targetType = action.Type;
 
 		switch (targetType)
 		{
@@ -633,8 +734,6 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, Activator activator, bo
 			break;
 
 		case TO_CAMERA:
-			trigger = *(data++);
-
 			if (keyResult == 1)
 				break;
 
@@ -662,8 +761,6 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, Activator activator, bo
 			break;
 
 		case TO_FLYBY:
-			trigger = *(data++);
-
 			if (keyResult == 1)
 				break;
 
@@ -784,8 +881,6 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, Activator activator, bo
 
 		case TO_VOLUMEEVENT:
 		case TO_GLOBALEVENT:
-			trigger = *(data++);
-
 			if (!switchOff)
 			{
 				auto& list = targetType == TO_VOLUMEEVENT ? g_Level.VolumeEventSets : g_Level.GlobalEventSets;
@@ -819,8 +914,7 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, Activator activator, bo
 		default:
 			break;
 		}
-
-	} while (!(trigger & END_BIT));
+	}
 
 	if (cameraItem && (Camera.type == CameraType::Fixed || Camera.type == CameraType::Heavy))
 		Camera.item = cameraItem;
@@ -58,6 +58,24 @@ enum TRIGOBJECTS_TYPES
 	TO_GLOBALEVENT
 };
 
+// Trigger floordata decoded once at level load. Sector trigger index points to program, which owns range of actions.
+struct TriggerAction
+{
+	TRIGOBJECTS_TYPES Type  = TO_OBJECT;
+	short			  Value = 0;
+	short			  Data  = 0; // Extra word of camera, flyby and event actions.
+};
+
+struct TriggerProgram
+{
+	TRIGGER_TYPES Type		  = TRIGGER;
+	short		  Flags		  = 0;
+	short		  Timer		  = 0;
+	short		  Value		  = 0; // Switch, key or pickup item number.
+	int			  ActionStart = 0;
+	int			  ActionCount = 0;
+};
+
 extern int TriggerTimer;
 extern int KeyTriggerActive;
 
@@ -66,10 +84,13 @@ int GetSwitchTrigger(ItemInfo* item, short* itemNumbersPtr, int attatchedToSwitc
 bool SwitchTrigger(short itemNumber, short timer);
 int KeyTrigger(short itemNumber);
 bool PickupTrigger(short itemNumber);
-void RefreshCamera(short type, short* data);
+void RefreshCamera(const TriggerProgram& program);
 int TriggerActive(ItemInfo* item);
 short* GetTriggerIndex(FloorInfo* floor, int x, int y, int z);
 short* GetTriggerIndex(ItemInfo* item);
+void CompileTriggers();
+const TriggerProgram* GetTriggerProgram(int triggerIndex);
+const TriggerAction& GetTriggerAction(const TriggerProgram& program, int actionIndex);
 void TestTriggers(int x, int y, int z, short roomNumber, bool heavy, int heavyFlags = 0);
 void TestTriggers(ItemInfo* item, bool isHeavy, int heavyFlags = 0);
 void ProcessSectorFlags(ItemInfo* item);
@@ -43,6 +43,8 @@ namespace TEN::Control::Volumes
 	void TestVolumes(short roomNumber, MESH_INFO* mesh);
 	void TestVolumes(CAMERA_INFO* camera);
 
+	bool TestVolumeContainment(const TriggerVolume& volume, const BoundingOrientedBox& box, short roomNumber);
+
 	bool HandleEvent(Event& event, Activator& activator);
 	bool HandleEvent(const std::string& name, EventType eventType, Activator activator);
 	void HandleAllGlobalEvents(EventType type, Activator& activator);
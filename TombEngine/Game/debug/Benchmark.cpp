@@ -0,0 +1,1196 @@
+#include "framework.h"
+#include "Game/Debug/Benchmark.h"
+
+#include <atomic>
+#include <chrono>
+#include <execution>
+#include <fstream>
+#include <numeric>
+#include <thread>
+
+#include "Game/animation.h"
+#include "Game/collision/collide_item.h"
+#include "Game/collision/collide_room.h"
+#include "Game/collision/floordata.h"
+#include "Game/collision/Point.h"
+#include "Game/collision/Sphere.h"
+#include "Game/control/box.h"
+#include "Game/control/los.h"
+#include "Game/control/lot.h"
+#include "Game/control/trigger.h"
+#include "Game/control/volume.h"
+#include "Game/effects/debris.h"
+#include "Game/effects/effects.h"
+#include "Game/items.h"
+#include "Game/Lara/lara.h"
+#include "Game/misc.h"
+#include "Game/people.h"
+#include "Game/room.h"
+#include "Game/Setup.h"
+#include "Objects/Generic/Object/Pushable/PushableInfo.h"
+#include "Objects/Generic/Object/Pushable/PushableObject.h"
+#include "Objects/Generic/Object/Pushable/PushableStack.h"
+#include "Renderer/Renderer.h"
+#include "Scripting/Include/Flow/ScriptInterfaceFlowHandler.h"
+#include "Specific/Input/InputSampler.h"
+#include "Specific/level.h"
+#include "Specific/trutils.h"
+
+using namespace TEN::Collision::Floordata;
+using namespace TEN::Collision::Point;
+using namespace TEN::Collision::Sphere;
+using namespace TEN::Control::Volumes;
+using namespace TEN::Entities::Generic;
+using namespace TEN::Input;
+using namespace TEN::Renderer;
+using namespace TEN::Utils;
+
+// Benchmarks are run on the currently loaded level when the engine is started with the -benchmark argument.
+// Results are logged and written as JSON lines to Logs/Benchmark.json.
+// Headless simulation runs (-headless -frames N) report through the same format to Logs/Simulation.json.
+
+namespace TEN::Debug
+{
+	constexpr auto BENCHMARK_PASS_COUNT			= 8;
+	constexpr auto BENCHMARK_SAMPLE_COUNT_MAX	= 1024;
+	constexpr auto BENCHMARK_SEARCH_COUNT_MAX	= 256;
+	constexpr auto BENCHMARK_ANIM_FRAME_COUNT	= 30;
+	constexpr auto BENCHMARK_PARTICLE_LIFE		= 255;
+	constexpr auto BENCHMARK_LOS_DISTANCE		= BLOCK(4);
+	constexpr auto BENCHMARK_DEBRIS_COUNT		= 2000;
+	constexpr auto BENCHMARK_CREATURE_COUNT		= 128;
+	constexpr auto BENCHMARK_INPUT_KEY			= 0x39; // Space.
+	constexpr auto BENCHMARK_INPUT_TAP_TIME		= std::chrono::milliseconds(4);
+
+#ifdef TEN_BENCHMARK_ALLOCATIONS
+	// Counter is per thread, so that only allocations made by measuring thread are counted,
+	// and worker threads of parallel phases never write to it.
+	static thread_local unsigned int AllocationCount = 0;
+	static auto IsCountingAllocations = std::atomic<bool>(false);
+#endif
+}
+
+#ifdef TEN_BENCHMARK_ALLOCATIONS
+// Global allocation hooks replace allocator of whole process, so they are only compiled into builds defining
+// TEN_BENCHMARK_ALLOCATIONS. Allocations are only counted while benchmark is being measured.
+// NOTE: Default nothrow and sized overloads forward to these, so every allocation and free is paired.
+
+static void* AllocateCounted(size_t size)
+{
+	if (TEN::Debug::IsCountingAllocations.load(std::memory_order_relaxed))
+		TEN::Debug::AllocationCount++;
+
+	void* ptr = std::malloc((size != 0) ? size : 1);
+	if (ptr == nullptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+static void* AllocateCountedAligned(size_t size, std::align_val_t align)
+{
+	if (TEN::Debug::IsCountingAllocations.load(std::memory_order_relaxed))
+		TEN::Debug::AllocationCount++;
+
+	void* ptr = _aligned_malloc((size != 0) ? size : 1, (size_t)align);
+	if (ptr == nullptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+void* operator new(size_t size)								{ return AllocateCounted(size); }
+void* operator new[](size_t size)							{ return AllocateCounted(size); }
+void* operator new(size_t size, std::align_val_t align)		{ return AllocateCountedAligned(size, align); }
+void* operator new[](size_t size, std::align_val_t align)	{ return AllocateCountedAligned(size, align); }
+
+void operator delete(void* ptr) noexcept								{ std::free(ptr); }
+void operator delete[](void* ptr) noexcept								{ std::free(ptr); }
+void operator delete(void* ptr, size_t size) noexcept					{ std::free(ptr); }
+void operator delete[](void* ptr, size_t size) noexcept					{ std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t align) noexcept		{ _aligned_free(ptr); }
+void operator delete[](void* ptr, std::align_val_t align) noexcept		{ _aligned_free(ptr); }
+void operator delete(void* ptr, size_t size, std::align_val_t align) noexcept	{ _aligned_free(ptr); }
+void operator delete[](void* ptr, size_t size, std::align_val_t align) noexcept	{ _aligned_free(ptr); }
+#endif
+
+namespace TEN::Debug
+{
+	// NOTE: Allocation count is NO_VALUE unless built with TEN_BENCHMARK_ALLOCATIONS.
+	template <typename TFunc>
+	static BenchmarkResult Measure(const std::string& name, unsigned int opCount, TFunc func)
+	{
+#ifdef TEN_BENCHMARK_ALLOCATIONS
+		AllocationCount = 0;
+		IsCountingAllocations.store(true);
+#endif
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		func();
+		auto endTime = std::chrono::high_resolution_clock::now();
+
+#ifdef TEN_BENCHMARK_ALLOCATIONS
+		IsCountingAllocations.store(false);
+		double allocsPerOp = (opCount != 0) ? ((double)AllocationCount / opCount) : 0.0;
+#else
+		double allocsPerOp = NO_VALUE;
+#endif
+
+		auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+		if (opCount == 0)
+			return BenchmarkResult{ name };
+
+		return BenchmarkResult{ name, opCount, (double)duration / opCount, allocsPerOp };
+	}
+
+	// Prevent benchmarked calls from being optimized away.
+	static void CheckChecksum(const std::string& name, int checksum)
+	{
+		if (checksum == INT_MAX)
+			TENLog(name + " benchmark checksum overflow.", LogLevel::Warning);
+	}
+
+	static std::vector<Vector3i> GetSectorProbePositions(std::vector<int>& roomNumbers)
+	{
+		auto positions = std::vector<Vector3i>{};
+		for (const auto& room : g_Level.Rooms)
+		{
+			int height = (room.BottomHeight + room.TopHeight) / 2;
+			for (const auto& sector : room.Sectors)
+			{
+				positions.push_back(Vector3i(sector.Position.x + BLOCK(0.5f), height, sector.Position.y + BLOCK(0.5f)));
+				roomNumbers.push_back(room.RoomNumber);
+			}
+		}
+
+		return positions;
+	}
+
+	// Heavier queries probe evenly distributed subset of sector positions.
+	static int GetSampleStride(int count)
+	{
+		return std::max(1, count / BENCHMARK_SAMPLE_COUNT_MAX);
+	}
+
+	static BenchmarkResult BenchmarkPointCollision(const std::vector<Vector3i>& positions, const std::vector<int>& roomNumbers)
+	{
+		int checksum = 0;
+		auto result = Measure("GetPointCollision", (unsigned int)positions.size() * BENCHMARK_PASS_COUNT, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < positions.size(); i++)
+				{
+					auto pointColl = GetPointCollision(positions[i], roomNumbers[i]);
+					checksum += pointColl.GetFloorHeight() - pointColl.GetCeilingHeight();
+				}
+			}
+		});
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	static std::vector<BenchmarkResult> BenchmarkPointCollisionBatch(const std::vector<Vector3i>& positions, const std::vector<int>& roomNumbers)
+	{
+		// Probe ring of points around each position at one height, as player state tests do.
+		constexpr auto RING_PROBE_COUNT = 8;
+		constexpr auto RING_RADIUS		= CLICK(1);
+		constexpr auto RING_HEIGHT		= -CLICK(2);
+
+		unsigned int opCount = (unsigned int)positions.size() * RING_PROBE_COUNT * BENCHMARK_PASS_COUNT;
+
+		int singleChecksum = 0;
+		auto singleResult = Measure("GetPointCollision (ring)", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				InvalidatePointCollisionCache();
+
+				for (int i = 0; i < positions.size(); i++)
+				{
+					for (int j = 0; j < RING_PROBE_COUNT; j++)
+					{
+						short headingAngle = (ANGLE(360.0f) / RING_PROBE_COUNT) * j;
+						auto pointColl = GetPointCollision(positions[i], roomNumbers[i], headingAngle, RING_RADIUS, RING_HEIGHT);
+						singleChecksum += pointColl.GetRoomNumber() + pointColl.GetFloorHeight();
+					}
+				}
+			}
+		});
+
+		int batchChecksum = 0;
+		auto batchResult = Measure("PointCollisionBatch (ring)", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				InvalidatePointCollisionCache();
+
+				for (int i = 0; i < positions.size(); i++)
+				{
+					auto probes = PointCollisionBatch(positions[i], roomNumbers[i]);
+					for (int j = 0; j < RING_PROBE_COUNT; j++)
+					{
+						short headingAngle = (ANGLE(360.0f) / RING_PROBE_COUNT) * j;
+						auto pointColl = probes.Get(headingAngle, RING_RADIUS, RING_HEIGHT);
+						batchChecksum += pointColl.GetRoomNumber() + pointColl.GetFloorHeight();
+					}
+				}
+			}
+		});
+
+		if (singleChecksum != batchChecksum)
+			TENLog("Batched point collision probes differ from single probes.", LogLevel::Warning);
+
+		return { singleResult, batchResult };
+	}
+
+	static BenchmarkResult BenchmarkFindRoomNumber(const std::vector<Vector3i>& positions)
+	{
+		// No start room, so every query takes global room lookup path.
+		int checksum = 0;
+		auto result = Measure("FindRoomNumber", (unsigned int)positions.size() * BENCHMARK_PASS_COUNT, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (const auto& pos : positions)
+					checksum += FindRoomNumber(pos);
+			}
+		});
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	static BenchmarkResult BenchmarkCollisionInfo(const std::vector<Vector3i>& positions, const std::vector<int>& roomNumbers)
+	{
+		// Probe with copy of player to leave actual item untouched.
+		auto probeItem = *LaraItem;
+		auto coll = CollisionInfo{};
+		coll.Setup.Mode = CollisionProbeMode::Quadrants;
+		coll.Setup.Radius = LARA_RADIUS;
+		coll.Setup.Height = LARA_HEIGHT;
+		coll.Setup.LowerFloorBound = NO_LOWER_BOUND;
+		coll.Setup.UpperFloorBound = -CLICK(1);
+		coll.Setup.LowerCeilingBound = 0;
+		coll.Setup.UpperCeilingBound = NO_UPPER_BOUND;
+
+		int stride = GetSampleStride((int)positions.size());
+		unsigned int opCount = (unsigned int)((positions.size() + stride - 1) / stride) * BENCHMARK_PASS_COUNT;
+
+		int checksum = 0;
+		auto result = Measure("GetCollisionInfo", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < positions.size(); i += stride)
+				{
+					probeItem.Pose.Position = positions[i];
+					probeItem.RoomNumber = roomNumbers[i];
+					coll.Setup.PrevPosition = positions[i];
+
+					GetCollisionInfo(&coll, &probeItem);
+					checksum += coll.Middle.Floor;
+				}
+			}
+		});
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	static BenchmarkResult BenchmarkCollidedObjects(const std::vector<Vector3i>& positions, const std::vector<int>& roomNumbers)
+	{
+		auto probeItem = *LaraItem;
+
+		int stride = GetSampleStride((int)positions.size());
+		unsigned int opCount = (unsigned int)((positions.size() + stride - 1) / stride) * BENCHMARK_PASS_COUNT;
+
+		int checksum = 0;
+		auto result = Measure("GetCollidedObjects", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < positions.size(); i += stride)
+				{
+					probeItem.Pose.Position = positions[i];
+					probeItem.RoomNumber = roomNumbers[i];
+
+					auto collObjects = GetCollidedObjects(probeItem, true, true, BLOCK(1));
+					checksum += (int)(collObjects.Items.size() + collObjects.Statics.size());
+				}
+			}
+		});
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	static BenchmarkResult BenchmarkItemSpheres()
+	{
+		// Test every collidable moveable against player, as item collision routines do each tick.
+		auto items = std::vector<ItemInfo>{};
+		for (const auto& item : g_Level.Items)
+		{
+			if (item.Index >= g_Level.NumItems || item.IsLara() || !item.Collidable || item.Status == ITEM_INVISIBLE)
+				continue;
+
+			const auto& object = Objects[item.ObjectNumber];
+			if (!object.loaded || object.nmeshes <= 0)
+				continue;
+
+			items.push_back(item);
+		}
+
+		auto playerItem = *LaraItem;
+		unsigned int opCount = (unsigned int)items.size() * BENCHMARK_PASS_COUNT * BENCHMARK_ANIM_FRAME_COUNT;
+
+		int checksum = 0;
+		auto result = Measure("ItemSphereCollision", opCount, [&]()
+		{
+			for (int pass = 0; pass < (BENCHMARK_PASS_COUNT * BENCHMARK_ANIM_FRAME_COUNT); pass++)
+			{
+				for (auto& item : items)
+					checksum += HandleItemSphereCollision(item, playerItem) ? 1 : 0;
+			}
+		});
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	static std::vector<BenchmarkResult> BenchmarkLos(const std::vector<Vector3i>& positions, const std::vector<int>& roomNumbers)
+	{
+		int stride = GetSampleStride((int)positions.size());
+		unsigned int opCount = (unsigned int)((positions.size() + stride - 1) / stride) * BENCHMARK_PASS_COUNT;
+		auto offset = Vector3i(BENCHMARK_LOS_DISTANCE, 0, BENCHMARK_LOS_DISTANCE);
+
+		int checksum = 0;
+		auto losResult = Measure("LOS", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < positions.size(); i += stride)
+				{
+					auto origin = GameVector(positions[i], roomNumbers[i]);
+					auto target = GameVector(positions[i] + offset, roomNumbers[i]);
+					checksum += LOS(&origin, &target) ? 1 : 0;
+				}
+			}
+		});
+
+		auto objectLosResult = Measure("ObjectOnLOS2", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < positions.size(); i += stride)
+				{
+					auto origin = GameVector(positions[i], roomNumbers[i]);
+					auto target = GameVector(positions[i] + offset, roomNumbers[i]);
+					auto hitPos = Vector3i::Zero;
+					MESH_INFO* mesh = nullptr;
+
+					checksum += ObjectOnLOS2(&origin, &target, &hitPos, &mesh);
+				}
+			}
+		});
+
+		// Fan of rays from each origin, as fired by shotgun pellets.
+		constexpr auto BATCH_RAY_COUNT = 6;
+
+		auto rays = std::vector<LosRay>(BATCH_RAY_COUNT);
+		auto batchResult = Measure("LosBatch", opCount * BATCH_RAY_COUNT, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < positions.size(); i += stride)
+				{
+					for (int j = 0; j < BATCH_RAY_COUNT; j++)
+					{
+						auto spread = Vector3i(0, CLICK(j - (BATCH_RAY_COUNT / 2)), 0);
+						rays[j] = LosRay{ GameVector(positions[i], roomNumbers[i]), GameVector(positions[i] + offset + spread, roomNumbers[i]) };
+					}
+
+					GetLosBatch(rays, true);
+					for (const auto& ray : rays)
+						checksum += ray.ObjectIndex + (ray.IsClear ? 1 : 0);
+				}
+			}
+		});
+
+		CheckChecksum(losResult.Name, checksum);
+		return { losResult, objectLosResult, batchResult };
+	}
+
+	static BenchmarkResult BenchmarkSearchLot()
+	{
+		int boxCount = (int)g_Level.PathfindingBoxes.size();
+		if (boxCount < 2)
+			return BenchmarkResult{ "SearchLOT" };
+
+		// Flood whole box graph towards evenly distributed target boxes using human zone.
+		auto lot = LOTInfo{};
+		lot.Node = std::vector<BoxNode>(boxCount, BoxNode{});
+		lot.Zone = ZoneType::Human;
+		lot.Step = BLOCK(1);
+		lot.Drop = -BLOCK(1);
+		lot.Fly = NO_FLYING;
+		lot.BlockMask = BLOCKED;
+		lot.CanJump = true;
+		ClearLOT(&lot);
+
+		int searchCount = std::min(boxCount, BENCHMARK_SEARCH_COUNT_MAX);
+		int stride = boxCount / searchCount;
+
+		int checksum = 0;
+		auto result = Measure("SearchLOT", searchCount * BENCHMARK_PASS_COUNT, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < searchCount; i++)
+				{
+					// NOTE: Search must be restarted with different target, otherwise head is invalid.
+					int boxNumber = (i * stride + pass) % boxCount;
+					if (boxNumber == lot.TargetBox)
+						continue;
+
+					lot.RequiredBox = boxNumber;
+					checksum += UpdateLOT(&lot, boxCount) ? 1 : 0;
+				}
+			}
+		});
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	static BenchmarkResult BenchmarkAnimateItem()
+	{
+		// Animate copies of player and active items so that level state is left untouched.
+		// Anim commands are stubbed out while measuring, as they play sounds, run flipeffects and spawn effects.
+		auto items = std::vector<ItemInfo>{ *LaraItem };
+		for (const auto& item : g_Level.Items)
+		{
+			if (item.Active && !item.IsLara() && item.Animation.AnimNumber >= 0)
+				items.push_back(item);
+		}
+
+		unsigned int opCount = (unsigned int)items.size() * BENCHMARK_ANIM_FRAME_COUNT * BENCHMARK_PASS_COUNT;
+
+		auto commandCounts = std::vector<int>{};
+		commandCounts.reserve(g_Level.Anims.size());
+		for (auto& anim : g_Level.Anims)
+		{
+			commandCounts.push_back(anim.NumCommands);
+			anim.NumCommands = 0;
+		}
+
+		int checksum = 0;
+		auto result = Measure("AnimateItem", opCount, [&]()
+		{
+			for (int frame = 0; frame < (BENCHMARK_ANIM_FRAME_COUNT * BENCHMARK_PASS_COUNT); frame++)
+			{
+				for (auto& item : items)
+				{
+					AnimateItem(&item);
+					checksum += item.Animation.FrameNumber;
+				}
+			}
+		});
+
+		for (int i = 0; i < g_Level.Anims.size(); i++)
+			g_Level.Anims[i].NumCommands = commandCounts[i];
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	static BenchmarkResult BenchmarkUpdateSparks()
+	{
+		// Live particles are restored afterwards.
+		auto savedParticles = std::vector<Particle>(std::begin(Particles), std::end(Particles));
+
+		// Fill particle array with long-living particles around player.
+		for (auto& particle : Particles)
+		{
+			particle = {};
+			particle.on = true;
+			particle.x = LaraItem->Pose.Position.x;
+			particle.y = LaraItem->Pose.Position.y - CLICK(2);
+			particle.z = LaraItem->Pose.Position.z;
+			particle.sLife =
+			particle.life = BENCHMARK_PARTICLE_LIFE;
+			particle.colFadeSpeed = 4;
+			particle.fadeToBlack = 4;
+			particle.dynamic = -1;
+			particle.roomNumber = LaraItem->RoomNumber;
+			particle.spriteIndex = Objects[ID_DEFAULT_SPRITES].meshIndex;
+			particle.blendMode = BlendMode::Additive;
+		}
+
+		RebuildParticlePool();
+
+		auto result = Measure("UpdateSparks", BENCHMARK_PASS_COUNT * BENCHMARK_ANIM_FRAME_COUNT, [&]()
+		{
+			for (int i = 0; i < (BENCHMARK_PASS_COUNT * BENCHMARK_ANIM_FRAME_COUNT); i++)
+				UpdateSparks();
+		});
+
+		std::copy(savedParticles.begin(), savedParticles.end(), Particles);
+		RebuildParticlePool();
+		return result;
+	}
+
+	static BenchmarkResult BenchmarkAllocateParticles()
+	{
+		// Spawn twice pool capacity per pass, so second half of spawns evicts oldest particles.
+		unsigned int opCount = (MAX_PARTICLES * 2) * BENCHMARK_PASS_COUNT;
+
+		// Live particles are restored afterwards.
+		auto savedParticles = std::vector<Particle>(std::begin(Particles), std::end(Particles));
+
+		for (auto& particle : Particles)
+			particle.on = false;
+
+		RebuildParticlePool();
+
+		int checksum = 0;
+		auto result = Measure("GetFreeParticle", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < (MAX_PARTICLES * 2); i++)
+				{
+					auto* particle = GetFreeParticle();
+					particle->on = true;
+					particle->life = BENCHMARK_PARTICLE_LIFE;
+					particle->flags = SP_NONE;
+
+					checksum += (int)(particle - Particles);
+				}
+
+				for (auto& particle : Particles)
+					particle.on = false;
+
+				RebuildParticlePool();
+			}
+		});
+
+		std::copy(savedParticles.begin(), savedParticles.end(), Particles);
+		RebuildParticlePool();
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	static BenchmarkResult BenchmarkUpdateDebris()
+	{
+		// Synthetic shatter: spawn fragments in a ring around player and simulate them until they settle.
+		auto origin = LaraItem->Pose.Position.ToVector3() - Vector3(0.0f, CLICK(2), 0.0f);
+		unsigned int opCount = BENCHMARK_DEBRIS_COUNT * BENCHMARK_PASS_COUNT * BENCHMARK_ANIM_FRAME_COUNT;
+
+		// Live debris is restored afterwards. Pool is large, so it is kept on heap.
+		auto savedDebris = std::make_unique<DebrisFragmentData>(DebrisFragments);
+		DisableDebris();
+
+		int checksum = 0;
+		auto result = Measure("UpdateDebris", opCount, [&]()
+		{
+			auto& debris = DebrisFragments;
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < BENCHMARK_DEBRIS_COUNT; i++)
+				{
+					int fragment = SpawnDebrisFragment();
+					if (fragment == NO_VALUE)
+						break;
+
+					float angle = (PI_MUL_2 * i) / BENCHMARK_DEBRIS_COUNT;
+					auto dir = Vector3(cos(angle), -0.5f, sin(angle));
+
+					debris.Positions[fragment] = origin + (dir * CLICK(1));
+					debris.Velocities[fragment] = dir * 40.0f;
+					debris.AngularVelocities[fragment] = dir * 0.39f;
+					debris.AngularDrags[fragment] = 0.95f;
+					debris.RoomNumbers[fragment] = LaraItem->RoomNumber;
+				}
+
+				for (int frame = 0; frame < BENCHMARK_ANIM_FRAME_COUNT; frame++)
+					UpdateDebris();
+
+				checksum += (int)debris.Count;
+				DisableDebris();
+			}
+		});
+
+		DebrisFragments = *savedDebris;
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	static BenchmarkResult BenchmarkInputSampler()
+	{
+		// Sampler owns keyboard while game is running, so mock device can only replace it in headless mode.
+		if (IsInputSamplerActive())
+		{
+			TENLog("Input sampler benchmark skipped because input device is active.", LogLevel::Info);
+			return BenchmarkResult{ "ConsumeInputEvents" };
+		}
+
+		auto backend = std::make_unique<MockInputSampleBackend>();
+		auto& mockDevice = *backend;
+		StartInputSampler(std::move(backend));
+
+		// Tap key once per simulated tick and release it before tick consumes events.
+		// With per-tick polling, every one of these taps would be missed.
+		unsigned int opCount = BENCHMARK_PASS_COUNT * BENCHMARK_ANIM_FRAME_COUNT;
+		unsigned int registeredTapCount = 0;
+		long long consumeTime = 0;
+
+		auto keys = std::array<bool, MAX_KEYBOARD_KEYS>{};
+		for (unsigned int i = 0; i < opCount; i++)
+		{
+			mockDevice.SetKey(BENCHMARK_INPUT_KEY, true);
+			std::this_thread::sleep_for(BENCHMARK_INPUT_TAP_TIME);
+			mockDevice.SetKey(BENCHMARK_INPUT_KEY, false);
+			std::this_thread::sleep_for(BENCHMARK_INPUT_TAP_TIME);
+
+			auto startTime = std::chrono::high_resolution_clock::now();
+			ConsumeInputEvents(keys);
+			auto endTime = std::chrono::high_resolution_clock::now();
+			consumeTime += std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+			if (keys[BENCHMARK_INPUT_KEY])
+				registeredTapCount++;
+		}
+
+		auto stats = GetInputSamplerStats();
+		StopInputSampler();
+
+		TENLog("Input sampler: " + std::to_string(registeredTapCount) + "/" + std::to_string(opCount) + " taps registered, " +
+			   std::to_string(stats.DroppedEventCount) + " events dropped, latency " + std::to_string(stats.AverageLatency) +
+			   " ms (max " + std::to_string(stats.MaxLatency) + " ms).", LogLevel::Info);
+
+		if (registeredTapCount != opCount)
+			TENLog("Input sampler lost " + std::to_string(opCount - registeredTapCount) + " taps.", LogLevel::Warning);
+
+		return BenchmarkResult{ "ConsumeInputEvents", opCount, (double)consumeTime / opCount };
+	}
+
+	static BenchmarkResult BenchmarkPushableStacks()
+	{
+		auto pushableItemNumbers = std::vector<int>{};
+		for (int itemNumber : FindAllPushables())
+		{
+			if (g_Level.Items[itemNumber].Data.is<PushableInfo>())
+				pushableItemNumbers.push_back(itemNumber);
+		}
+
+		// Replay unstack and restack of every pushable, as done when it settles after push, pull or fall.
+		// Search is purely positional, so links are only restored once all passes are done.
+		auto prevStacks = std::vector<PushableStackData>{};
+		for (int itemNumber : pushableItemNumbers)
+			prevStacks.push_back(GetPushableInfo(g_Level.Items[itemNumber]).Stack);
+
+		unsigned int opCount = (unsigned int)pushableItemNumbers.size() * BENCHMARK_PASS_COUNT;
+
+		auto result = Measure("SearchNearPushablesStack", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int itemNumber : pushableItemNumbers)
+				{
+					UnstackPushable(itemNumber);
+					int foundItemNumber = SearchNearPushablesStack(itemNumber);
+					StackPushable(itemNumber, foundItemNumber);
+				}
+			}
+		});
+
+		for (int i = 0; i < pushableItemNumbers.size(); i++)
+			GetPushableInfo(g_Level.Items[pushableItemNumbers[i]]).Stack = prevStacks[i];
+
+		int mismatchCount = ValidatePushableStackIndex();
+		if (mismatchCount != 0)
+			TENLog("Pushable stack index differs from full scan for " + std::to_string(mismatchCount) + " pushables.", LogLevel::Warning);
+
+		return result;
+	}
+
+	static BenchmarkResult BenchmarkUpdateBridges()
+	{
+		auto bridgeItemNumbers = std::vector<int>{};
+		for (const auto& item : g_Level.Items)
+		{
+			if (item.Index < g_Level.NumItems && item.IsBridge() && Objects[item.ObjectNumber].loaded)
+				bridgeItemNumbers.push_back(item.Index);
+		}
+
+		// Bridges are updated in place, as done by moving bridges every frame. Sector bridge lists end up unchanged.
+		int checksum = 0;
+		auto result = Measure("UpdateBridgeItem", (unsigned int)bridgeItemNumbers.size() * BENCHMARK_PASS_COUNT, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int itemNumber : bridgeItemNumbers)
+				{
+					const auto& item = g_Level.Items[itemNumber];
+
+					UpdateBridgeItem(item);
+					checksum += (int)GetPointCollision(item).GetSector().BridgeItemNumbers.size();
+				}
+			}
+		});
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	struct BenchmarkCreatureSense
+	{
+		AI_INFO Info		   = {};
+		int		BoxNumber	   = NO_VALUE;
+		int		EnemyBoxNumber = NO_VALUE;
+		bool	IsVisible	   = false;
+	};
+
+	static BenchmarkCreatureSense SenseBenchmarkCreature(ItemInfo& item)
+	{
+		auto* enemy = GetCreatureInfo(&item)->Enemy;
+		if (enemy == nullptr)
+			enemy = LaraItem;
+
+		auto sense = BenchmarkCreatureSense{};
+		CalculateCreatureAIInfo(&item, enemy, &sense.Info, sense.BoxNumber, sense.EnemyBoxNumber);
+		sense.IsVisible = TestTargetLos(&item, enemy);
+		return sense;
+	}
+
+	static std::vector<BenchmarkResult> BenchmarkCreatureSensing()
+	{
+		// Use active creatures. If there are none, temporarily enable AI of intelligent items.
+		auto enabledItemNumbers = std::vector<int>{};
+		if (ActiveCreatures.empty())
+		{
+			for (int i = 0; i < g_Level.NumItems; i++)
+			{
+				auto& item = g_Level.Items[i];
+				if (!Objects[item.ObjectNumber].loaded || !Objects[item.ObjectNumber].intelligent || item.IsCreature())
+					continue;
+
+				EnableEntityAI(i, true, false);
+				enabledItemNumbers.push_back(i);
+			}
+		}
+
+		auto creatureItemNumbers = std::vector<int>{};
+		for (const auto* creature : ActiveCreatures)
+		{
+			if (creature->ItemNumber != NO_VALUE)
+				creatureItemNumbers.push_back(creature->ItemNumber);
+		}
+
+		auto itemNumbers = std::vector<int>{};
+		if (!creatureItemNumbers.empty())
+		{
+			// Repeat creatures to simulate crowded level.
+			for (int i = 0; i < BENCHMARK_CREATURE_COUNT; i++)
+				itemNumbers.push_back(creatureItemNumbers[i % creatureItemNumbers.size()]);
+		}
+
+		UpdateBridgeCache();
+
+		unsigned int opCount = (unsigned int)itemNumbers.size() * BENCHMARK_PASS_COUNT;
+		auto serialSenses = std::vector<BenchmarkCreatureSense>(itemNumbers.size());
+		auto parallelSenses = std::vector<BenchmarkCreatureSense>(itemNumbers.size());
+		auto indices = std::vector<int>(itemNumbers.size());
+		std::iota(indices.begin(), indices.end(), 0);
+
+		auto serialResult = Measure("CreatureSensing (serial)", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i : indices)
+					serialSenses[i] = SenseBenchmarkCreature(g_Level.Items[itemNumbers[i]]);
+			}
+		});
+
+		auto parallelResult = Measure("CreatureSensing (parallel)", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				std::for_each(std::execution::par, indices.begin(), indices.end(),
+					[&](int i)
+					{
+						SetConcurrentPointCollision(true);
+						parallelSenses[i] = SenseBenchmarkCreature(g_Level.Items[itemNumbers[i]]);
+						SetConcurrentPointCollision(false);
+					});
+			}
+		});
+
+		// Parallel sensing must not depend on thread scheduling.
+		int checksum = 0;
+		for (int i : indices)
+		{
+			const auto& serialSense = serialSenses[i];
+			const auto& parallelSense = parallelSenses[i];
+
+			if (serialSense.BoxNumber != parallelSense.BoxNumber ||
+				serialSense.EnemyBoxNumber != parallelSense.EnemyBoxNumber ||
+				serialSense.Info.zoneNumber != parallelSense.Info.zoneNumber ||
+				serialSense.Info.enemyZone != parallelSense.Info.enemyZone ||
+				serialSense.Info.distance != parallelSense.Info.distance ||
+				serialSense.Info.angle != parallelSense.Info.angle ||
+				serialSense.Info.ahead != parallelSense.Info.ahead ||
+				serialSense.IsVisible != parallelSense.IsVisible)
+			{
+				TENLog("Parallel creature sensing differs from serial sensing.", LogLevel::Warning);
+				break;
+			}
+
+			checksum += parallelSense.IsVisible ? 1 : 0;
+		}
+
+		CheckChecksum(parallelResult.Name, checksum);
+
+		if (!itemNumbers.empty())
+		{
+			TENLog("Creature sensing of " + std::to_string(itemNumbers.size()) + " creatures: " +
+				std::to_string((serialResult.NsPerOp * itemNumbers.size()) / 1000000.0) + " ms serial, " +
+				std::to_string((parallelResult.NsPerOp * itemNumbers.size()) / 1000000.0) + " ms parallel per tick.", LogLevel::Info);
+		}
+
+		// NOTE: DisableEntityAI() can't be used, as it kills AI target which was not created.
+		for (int itemNumber : enabledItemNumbers)
+		{
+			auto& item = g_Level.Items[itemNumber];
+			auto* creature = GetCreatureInfo(&item);
+
+			ActiveCreatures.erase(std::find(ActiveCreatures.begin(), ActiveCreatures.end(), creature));
+			item.Data = nullptr;
+		}
+
+		return { serialResult, parallelResult };
+	}
+
+	// Previous recursive neighbor room search with per-room vectors, kept as reference for table built on level load.
+	static std::vector<int> GetNeighborRoomNumbersRecursive(int roomNumber, unsigned int searchDepth)
+	{
+		if (g_Level.Rooms.size() <= roomNumber || searchDepth == 0)
+			return {};
+
+		auto neighborRoomNumbers = std::vector<int>{};
+
+		const auto& room = g_Level.Rooms[roomNumber];
+		if (room.doors.empty())
+		{
+			neighborRoomNumbers.push_back(roomNumber);
+		}
+		else
+		{
+			for (const auto& door : room.doors)
+			{
+				neighborRoomNumbers.push_back(door.room);
+
+				auto recNeighborRoomNumbers = GetNeighborRoomNumbersRecursive(door.room, searchDepth - 1);
+				neighborRoomNumbers.insert(neighborRoomNumbers.end(), recNeighborRoomNumbers.begin(), recNeighborRoomNumbers.end());
+			}
+		}
+
+		std::sort(neighborRoomNumbers.begin(), neighborRoomNumbers.end());
+		neighborRoomNumbers.erase(std::unique(neighborRoomNumbers.begin(), neighborRoomNumbers.end()), neighborRoomNumbers.end());
+		return neighborRoomNumbers;
+	}
+
+	static std::vector<std::vector<int>> GetNeighborRoomListsRecursive()
+	{
+		constexpr auto NEIGHBOR_ROOM_SEARCH_DEPTH = 2;
+
+		auto neighborRoomLists = std::vector<std::vector<int>>(g_Level.Rooms.size());
+		for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+			neighborRoomLists[roomNumber] = GetNeighborRoomNumbersRecursive(roomNumber, NEIGHBOR_ROOM_SEARCH_DEPTH);
+
+		for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+		{
+			int flippedRoomNumber = g_Level.Rooms[roomNumber].flippedRoom;
+			if (flippedRoomNumber == NO_VALUE)
+				continue;
+
+			if (!Contains(neighborRoomLists[roomNumber], flippedRoomNumber))
+				neighborRoomLists[roomNumber].push_back(flippedRoomNumber);
+
+			if (!Contains(neighborRoomLists[flippedRoomNumber], roomNumber))
+				neighborRoomLists[flippedRoomNumber].push_back(roomNumber);
+		}
+
+		return neighborRoomLists;
+	}
+
+	static std::vector<BenchmarkResult> BenchmarkNeighborRooms(const std::vector<int>& roomNumbers)
+	{
+		unsigned int buildOpCount = (unsigned int)g_Level.Rooms.size() * BENCHMARK_PASS_COUNT;
+		unsigned int queryOpCount = (unsigned int)roomNumbers.size() * BENCHMARK_PASS_COUNT;
+
+		// Compare load time of per-room vectors with contiguous table.
+		// NOTE: Table is built into local buffer. Live table must not be rebuilt, as it may have been built before
+		// flipmaps of loaded savegame were applied, and its spans were swapped with rooms since.
+		auto neighborRoomLists = std::vector<std::vector<int>>{};
+		auto vectorBuildResult = Measure("NeighborRoomList build (vectors)", buildOpCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+				neighborRoomLists = GetNeighborRoomListsRecursive();
+		});
+
+		auto neighborRoomTable = std::vector<int>{};
+		auto starts = std::vector<int>{};
+		auto tableBuildResult = Measure("NeighborRoomList build (table)", buildOpCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+				BuildNeighborRoomTable(neighborRoomTable, starts);
+		});
+
+		for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+		{
+			auto begin = neighborRoomTable.begin() + starts[roomNumber];
+			auto end = neighborRoomTable.begin() + starts[roomNumber + 1];
+			if (!std::equal(begin, end, neighborRoomLists[roomNumber].begin(), neighborRoomLists[roomNumber].end()))
+			{
+				TENLog("Neighbor room table differs from recursive neighbor room search in room " + std::to_string(roomNumber) + ".", LogLevel::Warning);
+				break;
+			}
+		}
+
+		// Compare query cost of iterating neighbors, as done by collision and volume tests.
+		int vectorChecksum = 0;
+		auto vectorQueryResult = Measure("NeighborRooms query (vectors)", queryOpCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int roomNumber : roomNumbers)
+				{
+					for (int neighborRoomNumber : neighborRoomLists[roomNumber])
+						vectorChecksum += g_Level.Rooms[neighborRoomNumber].Active() ? 1 : 0;
+				}
+			}
+		});
+
+		int tableChecksum = 0;
+		auto tableQueryResult = Measure("NeighborRooms query (table)", queryOpCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int roomNumber : roomNumbers)
+				{
+					for (int i = starts[roomNumber]; i < starts[roomNumber + 1]; i++)
+						tableChecksum += g_Level.Rooms[neighborRoomTable[i]].Active() ? 1 : 0;
+				}
+			}
+		});
+
+		if (vectorChecksum != tableChecksum)
+			TENLog("Neighbor room table queries differ from per-room vector queries.", LogLevel::Warning);
+
+		CheckChecksum(tableQueryResult.Name, tableChecksum);
+		return { vectorBuildResult, tableBuildResult, vectorQueryResult, tableQueryResult };
+	}
+
+	static BenchmarkResult BenchmarkVolumes(const std::vector<Vector3i>& positions, const std::vector<int>& roomNumbers)
+	{
+		// NOTE: Only containment tests are measured. Event dispatch would run level scripts.
+		int checksum = 0;
+		auto result = Measure("TestVolumes", (unsigned int)positions.size() * BENCHMARK_PASS_COUNT, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < positions.size(); i++)
+				{
+					auto box = BoundingOrientedBox(positions[i].ToVector3(), Vector3(LARA_RADIUS, LARA_HEIGHT / 2, LARA_RADIUS), Quaternion::Identity);
+
+					for (int neighborRoomNumber : g_Level.Rooms[roomNumbers[i]].NeighborRoomNumbers)
+					{
+						for (const auto& volume : g_Level.Rooms[neighborRoomNumber].TriggerVolumes)
+						{
+							if (volume.Enabled && TestVolumeContainment(volume, box, roomNumbers[i]))
+								checksum++;
+						}
+					}
+				}
+			}
+		});
+
+		CheckChecksum(result.Name, checksum);
+		return result;
+	}
+
+	static std::vector<BenchmarkResult> BenchmarkCollectLights(const std::vector<Vector3i>& positions, const std::vector<int>& roomNumbers)
+	{
+		g_Renderer.UpdateLightGrid();
+
+		unsigned int opCount = (unsigned int)positions.size() * BENCHMARK_PASS_COUNT;
+
+		// Compare full scan of dynamic and neighbour room lights with light grid lookup.
+		int scanChecksum = 0;
+		auto scanResult = Measure("CollectLights (full scan)", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < positions.size(); i++)
+					scanChecksum += g_Renderer.CollectLightsAtPosition(positions[i].ToVector3(), roomNumbers[i], false);
+			}
+		});
+
+		int gridChecksum = 0;
+		auto gridResult = Measure("CollectLights (light grid)", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int i = 0; i < positions.size(); i++)
+					gridChecksum += g_Renderer.CollectLightsAtPosition(positions[i].ToVector3(), roomNumbers[i], true);
+			}
+		});
+
+		if (scanChecksum != gridChecksum)
+			TENLog("Light grid selected different light count than full scan.", LogLevel::Warning);
+
+		return { scanResult, gridResult };
+	}
+
+	static std::vector<BenchmarkResult> BenchmarkTriggerDecode()
+	{
+		auto triggerIndices = std::vector<int>{};
+		for (const auto& room : g_Level.Rooms)
+		{
+			for (const auto& sector : room.Sectors)
+			{
+				if (sector.TriggerIndex != NO_VALUE)
+					triggerIndices.push_back(sector.TriggerIndex);
+			}
+		}
+
+		// NOTE: Only decoding is measured. Executing actions would change level state.
+		unsigned int opCount = (unsigned int)triggerIndices.size() * BENCHMARK_PASS_COUNT;
+
+		int floorDataChecksum = 0;
+		auto floorDataResult = Measure("TriggerDecode (floordata)", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int triggerIndex : triggerIndices)
+				{
+					const short* data = &g_Level.FloorData[triggerIndex];
+					int triggerType = (*(data++) >> 8) & TRIGGER_BITS;
+					floorDataChecksum += triggerType + (*(data++) & TIMER_BITS);
+
+					if (triggerType == TRIGGER_TYPES::SWITCH || triggerType == TRIGGER_TYPES::KEY || triggerType == TRIGGER_TYPES::PICKUP)
+						floorDataChecksum += *(data++) & VALUE_BITS;
+
+					short trigger = 0;
+					do
+					{
+						trigger = *(data++);
+						int targetType = (trigger >> 10) & FUNCTION_BITS;
+						floorDataChecksum += targetType + (trigger & VALUE_BITS);
+
+						if (targetType == TO_CAMERA || targetType == TO_FLYBY || targetType == TO_VOLUMEEVENT || targetType == TO_GLOBALEVENT)
+							trigger = *(data++);
+					} while (!(trigger & END_BIT));
+				}
+			}
+		});
+
+		int compiledChecksum = 0;
+		auto compiledResult = Measure("TriggerDecode (compiled)", opCount, [&]()
+		{
+			for (int pass = 0; pass < BENCHMARK_PASS_COUNT; pass++)
+			{
+				for (int triggerIndex : triggerIndices)
+				{
+					const auto* program = GetTriggerProgram(triggerIndex);
+					compiledChecksum += program->Type + program->Timer + program->Value;
+
+					for (int i = 0; i < program->ActionCount; i++)
+					{
+						const auto& action = GetTriggerAction(*program, i);
+						compiledChecksum += action.Type + action.Value;
+					}
+				}
+			}
+		});
+
+		if (floorDataChecksum != compiledChecksum)
+			TENLog("Compiled triggers differ from floordata.", LogLevel::Warning);
+
+		return { floorDataResult, compiledResult };
+	}
+
+	void WriteBenchmarkResults(const std::vector<BenchmarkResult>& results, const std::string& fileName)
+	{
+		auto path = g_GameFlow->GetGameDir() + "Logs/" + fileName;
+		auto file = std::ofstream(path, std::ios::out | std::ios::trunc);
+
+		for (const auto& result : results)
+		{
+			auto line = "{\"name\":\"" + result.Name + "\",\"ops\":" + std::to_string(result.OpCount) +
+						",\"ns_per_op\":" + std::to_string(result.NsPerOp) +
+						",\"allocs_per_op\":" + ((result.AllocsPerOp >= 0.0) ? std::to_string(result.AllocsPerOp) : "null") + "}";
+
+			TENLog("Benchmark: " + line, LogLevel::Info);
+			if (file.is_open())
+				file << line << std::endl;
+		}
+	}
+
+	void RunBenchmarks()
+	{
+		unsigned int sectorCount = 0;
+		for (const auto& room : g_Level.Rooms)
+			sectorCount += (unsigned int)room.Sectors.size();
+
+		TENLog("Sector size: " + std::to_string(sizeof(FloorInfo)) + " bytes, " +
+			   std::to_string(sectorCount) + " sectors (" + std::to_string((sizeof(FloorInfo) * sectorCount) / 1024) + " KB).", LogLevel::Info);
+
+		auto roomNumbers = std::vector<int>{};
+		auto positions = GetSectorProbePositions(roomNumbers);
+
+		auto results = std::vector<BenchmarkResult>{};
+		results.push_back(BenchmarkPointCollision(positions, roomNumbers));
+
+		auto batchResults = BenchmarkPointCollisionBatch(positions, roomNumbers);
+		results.insert(results.end(), batchResults.begin(), batchResults.end());
+
+		results.push_back(BenchmarkFindRoomNumber(positions));
+		results.push_back(BenchmarkCollisionInfo(positions, roomNumbers));
+		results.push_back(BenchmarkCollidedObjects(positions, roomNumbers));
+		results.push_back(BenchmarkItemSpheres());
+
+		auto losResults = BenchmarkLos(positions, roomNumbers);
+		results.insert(results.end(), losResults.begin(), losResults.end());
+
+		results.push_back(BenchmarkSearchLot());
+		results.push_back(BenchmarkAnimateItem());
+		results.push_back(BenchmarkUpdateSparks());
+		results.push_back(BenchmarkAllocateParticles());
+		results.push_back(BenchmarkUpdateDebris());
+		results.push_back(BenchmarkInputSampler());
+		results.push_back(BenchmarkPushableStacks());
+		results.push_back(BenchmarkUpdateBridges());
+
+		auto sensingResults = BenchmarkCreatureSensing();
+		results.insert(results.end(), sensingResults.begin(), sensingResults.end());
+
+		auto neighborRoomResults = BenchmarkNeighborRooms(roomNumbers);
+		results.insert(results.end(), neighborRoomResults.begin(), neighborRoomResults.end());
+
+		results.push_back(BenchmarkVolumes(positions, roomNumbers));
+
+		auto lightResults = BenchmarkCollectLights(positions, roomNumbers);
+		results.insert(results.end(), lightResults.begin(), lightResults.end());
+
+		auto triggerResults = BenchmarkTriggerDecode();
+		results.insert(results.end(), triggerResults.begin(), triggerResults.end());
+
+		WriteBenchmarkResults(results, "Benchmark.json");
+	}
+}
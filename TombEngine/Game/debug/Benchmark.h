@@ -0,0 +1,15 @@
+#pragma once
+
+namespace TEN::Debug
+{
+	struct BenchmarkResult
+	{
+		std::string	 Name		 = {};
+		unsigned int OpCount	 = 0;
+		double		 NsPerOp	 = 0.0;
+		double		 AllocsPerOp = 0.0;
+	};
+
+	void RunBenchmarks();
+	void WriteBenchmarkResults(const std::vector<BenchmarkResult>& results, const std::string& fileName);
+}
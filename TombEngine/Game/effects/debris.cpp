@@ -8,6 +8,7 @@
 #include "Specific/level.h"
 #include "Math/Math.h"
 
+using namespace TEN::Collision::Floordata;
 using namespace TEN::Collision::Sphere;
 using namespace TEN::Math;
 using namespace TEN::Renderer;
@@ -17,7 +18,14 @@ SHATTER_ITEM ShatterItem;
 short SmashedMeshCount;
 MESH_INFO* SmashedMesh[32];
 short SmashedMeshRoom[32];
-std::array<DebrisFragment, MAX_DEBRIS> DebrisFragments;
+DebrisFragmentData DebrisFragments;
+
+constexpr auto DEBRIS_TERMINAL_VELOCITY = 1024.0f;
+constexpr auto DEBRIS_GRAVITY			= Vector3(0.0f, 7.0f, 0.0f);
+constexpr auto DEBRIS_LINEAR_DRAG		= 0.99f;
+constexpr auto DEBRIS_RESTITUTION		= 0.6f;
+constexpr auto DEBRIS_FRICTION			= 0.6f;
+constexpr auto DEBRIS_BOUNCE_COUNT_MAX	= 3;
 
 bool ExplodeItemNode(ItemInfo* item, int node, int noXZVel, int bits)
 {
@@ -27,7 +35,7 @@ bool ExplodeItemNode(ItemInfo* item, int node, int noXZVel, int bits)
 		if (number == BODY_DO_EXPLOSION)
 			number = -64;
 
-		auto spheres = item->GetSpheres();
+		const auto& spheres = item->GetSpheres();
 		ShatterItem.yRot = item->Pose.Orientation.y;
 		ShatterItem.bit = 1 << node;
 		ShatterItem.meshIndex = Objects[item->ObjectNumber].meshIndex + node;
@@ -45,15 +53,40 @@ bool ExplodeItemNode(ItemInfo* item, int node, int noXZVel, int bits)
 	return false;
 }
 
-DebrisFragment* GetFreeDebrisFragment()
+int SpawnDebrisFragment()
 {
-	for (auto& frag : DebrisFragments) 
-	{
-		if (!frag.active)
-			return &frag;
-	}
+	auto& debris = DebrisFragments;
+	if (debris.Count >= MAX_DEBRIS)
+		return NO_VALUE;
+
+	int i = debris.Count++;
+	debris.Rotations[i] = Quaternion::Identity;
+	debris.BounceCounts[i] = 0;
+	debris.Sectors[i] = {};
+	return i;
+}
 
-	return nullptr;
+static void KillDebrisFragment(int i)
+{
+	auto& debris = DebrisFragments;
+
+	int last = --debris.Count;
+	if (i == last)
+		return;
+
+	debris.Positions[i] = debris.Positions[last];
+	debris.Velocities[i] = debris.Velocities[last];
+	debris.Rotations[i] = debris.Rotations[last];
+	debris.AngularVelocities[i] = debris.AngularVelocities[last];
+	debris.AngularDrags[i] = debris.AngularDrags[last];
+	debris.RoomNumbers[i] = debris.RoomNumbers[last];
+	debris.BounceCounts[i] = debris.BounceCounts[last];
+	debris.Sectors[i] = debris.Sectors[last];
+	debris.Transforms[i] = debris.Transforms[last];
+	debris.Meshes[i] = debris.Meshes[last];
+	debris.Colors[i] = debris.Colors[last];
+	debris.LightModes[i] = debris.LightModes[last];
+	debris.IsStatic[i] = debris.IsStatic[last];
 }
 
 void ShatterObject(SHATTER_ITEM* item, MESH_INFO* mesh, int num, short roomNumber, int noZXVel)
@@ -92,6 +125,8 @@ void ShatterObject(SHATTER_ITEM* item, MESH_INFO* mesh, int num, short roomNumbe
 	}
 
 	auto fragmentsMesh = &g_Level.Meshes[meshIndex];
+	auto rotationMatrix = Matrix::CreateFromYawPitchRoll(TO_RAD(yRot), 0, 0);
+	auto& debris = DebrisFragments;
 
 	for (auto& renderBucket : fragmentsMesh->buckets)
 	{
@@ -121,12 +156,9 @@ void ShatterObject(SHATTER_ITEM* item, MESH_INFO* mesh, int num, short roomNumbe
 
 			for (int j = 0; j < (poly->shape == SHAPE_RECTANGLE ? 2 : 1); j++)
 			{
-				DebrisFragment* fragment = GetFreeDebrisFragment();
-
-				if (!fragment)
-					break;
-
-				Matrix rotationMatrix = Matrix::CreateFromYawPitchRoll(TO_RAD(yRot), 0, 0);
+				int fragment = SpawnDebrisFragment();
+				if (fragment == NO_VALUE)
+					return;
 
 				Vector3 pos1 = fragmentsMesh->positions[poly->indices[indices[j * 3 + 0]]] * scale;
 				Vector3 pos2 = fragmentsMesh->positions[poly->indices[indices[j * 3 + 1]]] * scale;
@@ -148,41 +180,36 @@ void ShatterObject(SHATTER_ITEM* item, MESH_INFO* mesh, int num, short roomNumbe
 				Vector3 localPos = (pos1 + pos2 + pos3) / 3;
 				Vector3 worldPos = Vector3::Transform(localPos, rotationMatrix);
 
-				fragment->worldPosition = worldPos + pos;
-
-				fragment->mesh.Positions[0] = pos1 - localPos;
-				fragment->mesh.Positions[1] = pos2 - localPos;
-				fragment->mesh.Positions[2] = pos3 - localPos;
-
-				fragment->mesh.TextureCoordinates[0] = uv1;
-				fragment->mesh.TextureCoordinates[1] = uv2;
-				fragment->mesh.TextureCoordinates[2] = uv3;
-
-				fragment->mesh.Normals[0] = normal1;
-				fragment->mesh.Normals[1] = normal2;
-				fragment->mesh.Normals[2] = normal3;
-
-				fragment->mesh.Colors[0] = Vector4(color1.x, color1.y, color1.z, 1.0f);
-				fragment->mesh.Colors[1] = Vector4(color2.x, color2.y, color2.z, 1.0f);
-				fragment->mesh.Colors[2] = Vector4(color3.x, color3.y, color3.z, 1.0f);
-
-				fragment->mesh.blendMode = renderBucket.blendMode;
-				fragment->mesh.tex = renderBucket.texture;
-
-				fragment->isStatic = isStatic;
-				fragment->active = true;
-				fragment->terminalVelocity = 1024;
-				fragment->gravity = Vector3(0, 7, 0);
-				fragment->restitution = 0.6f;
-				fragment->friction = 0.6f;
-				fragment->linearDrag = .99f;
-				fragment->angularVelocity = Vector3(Random::GenerateFloat(-1, 1) * 0.39, Random::GenerateFloat(-1, 1) * 0.39, Random::GenerateFloat(-1, 1) * 0.39);
-				fragment->angularDrag = Random::GenerateFloat(0.9f, 0.999f);
-				fragment->velocity = CalculateFragmentImpactVelocity(fragment->worldPosition, ShatterImpactData.impactDirection, ShatterImpactData.impactLocation);
-				fragment->roomNumber = roomNumber;
-				fragment->numBounces = 0;
-				fragment->color = isStatic ? mesh->color : item->color;
-				fragment->lightMode = fragmentsMesh->lightMode;
+				debris.Positions[fragment] = worldPos + pos;
+
+				auto& fragmentMesh = debris.Meshes[fragment];
+				fragmentMesh.Positions[0] = pos1 - localPos;
+				fragmentMesh.Positions[1] = pos2 - localPos;
+				fragmentMesh.Positions[2] = pos3 - localPos;
+
+				fragmentMesh.TextureCoordinates[0] = uv1;
+				fragmentMesh.TextureCoordinates[1] = uv2;
+				fragmentMesh.TextureCoordinates[2] = uv3;
+
+				fragmentMesh.Normals[0] = normal1;
+				fragmentMesh.Normals[1] = normal2;
+				fragmentMesh.Normals[2] = normal3;
+
+				fragmentMesh.Colors[0] = Vector4(color1.x, color1.y, color1.z, 1.0f);
+				fragmentMesh.Colors[1] = Vector4(color2.x, color2.y, color2.z, 1.0f);
+				fragmentMesh.Colors[2] = Vector4(color3.x, color3.y, color3.z, 1.0f);
+
+				fragmentMesh.blendMode = renderBucket.blendMode;
+				fragmentMesh.tex = renderBucket.texture;
+
+				debris.IsStatic[fragment] = isStatic;
+				debris.AngularVelocities[fragment] = Vector3(Random::GenerateFloat(-1, 1) * 0.39, Random::GenerateFloat(-1, 1) * 0.39, Random::GenerateFloat(-1, 1) * 0.39);
+				debris.AngularDrags[fragment] = Random::GenerateFloat(0.9f, 0.999f);
+				debris.Velocities[fragment] = CalculateFragmentImpactVelocity(debris.Positions[fragment], ShatterImpactData.impactDirection, ShatterImpactData.impactLocation);
+				debris.RoomNumbers[fragment] = roomNumber;
+				debris.Colors[fragment] = isStatic ? mesh->color : item->color;
+				debris.LightModes[fragment] = fragmentsMesh->lightMode;
+				debris.Transforms[fragment] = Matrix::CreateTranslation(debris.Positions[fragment]);
 			}
 		}
 	}
@@ -204,62 +231,106 @@ Vector3 CalculateFragmentImpactVelocity(const Vector3& fragmentWorldPosition, co
 
 void DisableDebris()
 {
-	for (auto& deb : DebrisFragments)
+	DebrisFragments.Count = 0;
+}
+
+// Cached sectors point into room sector arrays, which are swapped between rooms on flipmap.
+void InvalidateDebrisSectors()
+{
+	auto& debris = DebrisFragments;
+	for (unsigned int i = 0; i < debris.Count; i++)
+		debris.Sectors[i] = {};
+}
+
+static bool IsSurfaceFlat(const SectorSurfaceData& surface)
+{
+	const auto& plane0 = surface.Triangles[0].Plane;
+	const auto& plane1 = surface.Triangles[1].Plane;
+	return (plane0 == plane1 && plane0.Normal().x == 0.0f && plane0.Normal().z == 0.0f);
+}
+
+// Sector is only probed again when fragment changes room or sector, or leaves sector's vertical span.
+static const DebrisSectorCache& GetDebrisSector(int i)
+{
+	auto& debris = DebrisFragments;
+	auto& cache = debris.Sectors[i];
+	const auto& pos = debris.Positions[i];
+
+	auto sectorPoint = Vector2i((int)floor(pos.x / BLOCK(1)), (int)floor(pos.z / BLOCK(1)));
+	if (cache.Sector != nullptr && cache.RoomNumber == debris.RoomNumbers[i] && cache.SectorPoint == sectorPoint)
 	{
-		deb.active = false;
+		if (!cache.IsFlat)
+		{
+			cache.FloorHeight = cache.Sector->GetSurfaceHeight(pos.x, pos.z, true);
+			cache.CeilingHeight = cache.Sector->GetSurfaceHeight(pos.x, pos.z, false);
+		}
+
+		if (pos.y >= cache.CeilingHeight && pos.y <= cache.FloorHeight)
+			return cache;
 	}
+
+	short roomNumber = debris.RoomNumbers[i];
+	cache.Sector = GetFloor(pos.x, pos.y, pos.z, &roomNumber);
+	cache.RoomNumber = debris.RoomNumbers[i];
+	cache.SectorPoint = sectorPoint;
+	cache.IsFlat = (IsSurfaceFlat(cache.Sector->FloorSurface) && IsSurfaceFlat(cache.Sector->CeilingSurface));
+	cache.FloorHeight = cache.Sector->GetSurfaceHeight(pos.x, pos.z, true);
+	cache.CeilingHeight = cache.Sector->GetSurfaceHeight(pos.x, pos.z, false);
+	return cache;
 }
 
 void UpdateDebris()
 {
-	for (auto& deb : DebrisFragments)
+	auto& debris = DebrisFragments;
+
+	unsigned int i = 0;
+	while (i < debris.Count)
 	{
-		if (deb.active)
+		auto& pos = debris.Positions[i];
+		auto& vel = debris.Velocities[i];
+		auto& angularVel = debris.AngularVelocities[i];
+
+		vel *= DEBRIS_LINEAR_DRAG;
+		vel += DEBRIS_GRAVITY;
+		vel = XMVector3ClampLength(vel, 0, DEBRIS_TERMINAL_VELOCITY);
+		debris.Rotations[i] *= Quaternion::CreateFromYawPitchRoll(angularVel.x, angularVel.y, angularVel.z);
+		pos += vel;
+		angularVel *= debris.AngularDrags[i];
+
+		const auto& sector = GetDebrisSector(i);
+		if (pos.y < sector.CeilingHeight)
 		{
-			FloorInfo* floor;
-			short roomNumber;
-
-			deb.velocity *= deb.linearDrag;
-			deb.velocity += deb.gravity;
-			deb.velocity = XMVector3ClampLength(deb.velocity, 0, deb.terminalVelocity);
-			deb.rotation *= Quaternion::CreateFromYawPitchRoll(deb.angularVelocity.x, deb.angularVelocity.y, deb.angularVelocity.z);
-			deb.worldPosition += deb.velocity;
-			deb.angularVelocity *= deb.angularDrag;
-
-			roomNumber = deb.roomNumber;
-			floor = GetFloor(deb.worldPosition.x, deb.worldPosition.y, deb.worldPosition.z, &roomNumber);
+			auto roomNumber = sector.Sector->GetNextRoomNumber(pos, false);
+			if (roomNumber.has_value())
+				debris.RoomNumbers[i] = *roomNumber;
+		}
 
-			if (deb.worldPosition.y < floor->GetSurfaceHeight(deb.worldPosition.x, deb.worldPosition.z, false))
+		if (pos.y > sector.FloorHeight)
+		{
+			auto roomNumber = sector.Sector->GetNextRoomNumber(pos, true);
+			if (roomNumber.has_value())
 			{
-				auto roomNumber = floor->GetNextRoomNumber(deb.worldPosition, false);
-				if (roomNumber.has_value())
-					deb.roomNumber = *roomNumber;
+				debris.RoomNumbers[i] = *roomNumber;
+				i++;
+				continue;
 			}
 
-			if (deb.worldPosition.y > floor->GetSurfaceHeight(deb.worldPosition.x, deb.worldPosition.z, true))
+			if (debris.BounceCounts[i] > DEBRIS_BOUNCE_COUNT_MAX)
 			{
-				auto roomNumber = floor->GetNextRoomNumber(deb.worldPosition, true);
-				if (roomNumber.has_value())
-				{
-					deb.roomNumber = *roomNumber;
-					continue;
-				}
-
-				if (deb.numBounces > 3)
-				{
-					deb.active = false;
-					continue;
-				}
-				
-				deb.velocity.y *= -deb.restitution;
-				deb.velocity.x *= deb.friction;
-				deb.velocity.z *= deb.friction;
-				deb.numBounces++;
+				KillDebrisFragment(i);
+				continue;
 			}
 
-			auto translation = Matrix::CreateTranslation(deb.worldPosition.x, deb.worldPosition.y, deb.worldPosition.z);
-			auto rotation = Matrix::CreateFromQuaternion(deb.rotation);
-			deb.Transform = rotation * translation;
+			vel.y *= -DEBRIS_RESTITUTION;
+			vel.x *= DEBRIS_FRICTION;
+			vel.z *= DEBRIS_FRICTION;
+			debris.BounceCounts[i]++;
 		}
+
+		auto& transform = debris.Transforms[i];
+		transform = Matrix::CreateFromQuaternion(debris.Rotations[i]);
+		transform.Translation(pos);
+
+		i++;
 	}
 }
@@ -50,30 +50,42 @@ struct DebrisMesh
 	int tex;
 };
 
-struct DebrisFragment
+// Debris fragments are stored as structure of arrays. Active fragments are packed at the front,
+// so update and draw loops only touch live data. Killed fragments are replaced by the last active one.
+struct DebrisSectorCache
 {
-	DebrisMesh mesh;
-	Quaternion rotation;
-	Vector3 angularVelocity;
-	Vector3 worldPosition;
-	Vector3  velocity;
-	Vector3 gravity;
-	float terminalVelocity;
-	float linearDrag;
-	float angularDrag;
-	float friction;
-	float restitution;
-	Vector4 color;
-	LightMode lightMode;
-	int roomNumber;
-	int numBounces;
-	bool active;
-	bool isStatic;
-	Matrix Transform;
+	FloorInfo* Sector		 = nullptr;
+	int		   RoomNumber	 = NO_VALUE; // Room number the sector was probed from.
+	Vector2i   SectorPoint	 = Vector2i::Zero;
+	bool	   IsFlat		 = false;
+	int		   FloorHeight	 = 0; // At fragment position. Reused while fragment stays in flat sector.
+	int		   CeilingHeight = 0;
+};
+
+struct DebrisFragmentData
+{
+	unsigned int Count = 0;
+
+	// Simulation data.
+	std::array<Vector3, MAX_DEBRIS>			  Positions			= {};
+	std::array<Vector3, MAX_DEBRIS>			  Velocities		= {};
+	std::array<Quaternion, MAX_DEBRIS>		  Rotations			= {};
+	std::array<Vector3, MAX_DEBRIS>			  AngularVelocities = {};
+	std::array<float, MAX_DEBRIS>			  AngularDrags		= {};
+	std::array<int, MAX_DEBRIS>				  RoomNumbers		= {};
+	std::array<int, MAX_DEBRIS>				  BounceCounts		= {};
+	std::array<DebrisSectorCache, MAX_DEBRIS> Sectors			= {};
+
+	// Render data.
+	std::array<Matrix, MAX_DEBRIS>	   Transforms = {};
+	std::array<DebrisMesh, MAX_DEBRIS> Meshes	  = {};
+	std::array<Vector4, MAX_DEBRIS>	   Colors	  = {};
+	std::array<LightMode, MAX_DEBRIS>  LightModes = {};
+	std::array<bool, MAX_DEBRIS>	   IsStatic	  = {};
 };
 
 extern SHATTER_ITEM ShatterItem;
-extern std::array<DebrisFragment, MAX_DEBRIS> DebrisFragments;
+extern DebrisFragmentData DebrisFragments;
 extern ShatterImpactInfo ShatterImpactData;
 extern short SmashedMeshCount;
 extern MESH_INFO* SmashedMesh[32];
@@ -81,7 +93,8 @@ extern short SmashedMeshRoom[32];
 
 bool ExplodeItemNode(ItemInfo* item, int node, int noXZVel, int bits);
 void ShatterObject(SHATTER_ITEM* item, MESH_INFO* mesh, int num, short roomNumber, int noZXVel);
-DebrisFragment* GetFreeDebrisFragment();
+int SpawnDebrisFragment();
 Vector3 CalculateFragmentImpactVelocity(const Vector3& fragmentWorldPosition, const Vector3& impactDirection, const Vector3& impactLocation);
 void DisableDebris();
+void InvalidateDebrisSectors();
 void UpdateDebris();
@@ -25,6 +25,7 @@
 #include "Sound/sound.h"
 #include "Specific/clock.h"
 #include "Specific/level.h"
+#include "Specific/memory/FixedPool.h"
 
 using namespace TEN::Collision::Point;
 using namespace TEN::Effects::Blood;
@@ -37,6 +38,7 @@ using namespace TEN::Effects::Ripple;
 using namespace TEN::Effects::Spark;
 using namespace TEN::Math;
 using namespace TEN::Math::Random;
+using namespace TEN::Memory;
 
 using TEN::Renderer::g_Renderer;
 
@@ -45,6 +47,7 @@ constexpr int WIBBLE_MAX = UCHAR_MAX - WIBBLE_SPEED + 1;
 
 // New particle class
 Particle Particles[MAX_PARTICLES];
+static auto ParticlePool = FixedPool<MAX_PARTICLES>();
 ParticleDynamic ParticleDynamics[MAX_PARTICLE_DYNAMICS];
 
 FX_INFO EffectList[NUM_EFFECTS];
@@ -124,39 +127,20 @@ void DetatchSpark(int number, SpriteEnumFlag type)
 	}
 }
 
-Particle* GetFreeParticle()
+void RebuildParticlePool()
 {
-	int result = -1;
-
-	// Get first free available spark
-
-	for (int i = 0; i < MAX_PARTICLES; i++)
-	{
-		auto* particle = &Particles[i];
-
-		if (!particle->on)
-		{
-			result = i;
-			break;
-		}
-	}
-
-	// No free sparks left, hijack existing one with less possible life
+	ParticlePool.Rebuild([](int slot) { return Particles[slot].on; });
+}
 
-	int life = INT_MAX;
-	if (result == -1)
-	{
-		for (int i = 0; i < MAX_PARTICLES; i++)
+Particle* GetFreeParticle()
+{
+	// If no free particles are left, hijack oldest one which isn't emitting light or exploding.
+	int result = ParticlePool.AllocateOrEvict(
+		[](int slot)
 		{
-			auto* particle = &Particles[i];
-
-			if (particle->life < life && particle->dynamic == -1 && !(particle->flags & SP_EXPLOSION))
-			{
-				result = i;
-				life = particle->life;
-			}
-		}
-	}
+			const auto& particle = Particles[slot];
+			return (particle.dynamic == -1 && !(particle.flags & SP_EXPLOSION));
+		});
 
 	auto* spark = &Particles[result];
 
@@ -192,6 +176,45 @@ void UpdateWibble()
 
 }
 
+// Particles spawned relative to effect or item joint are detached into world space after a few frames.
+// NOTE: Done here instead of renderer, so that particle state doesn't depend on whether frame was drawn.
+static void DetachParticle(Particle& particle)
+{
+	if (!(particle.flags & SP_DEF))
+		return;
+
+	if (particle.flags & SP_FX)
+	{
+		if ((particle.sLife - particle.life) <= GenerateInt(8, 12))
+			return;
+
+		const auto& fx = EffectList[particle.fxObj];
+
+		particle.flags &= ~SP_FX;
+		particle.x += fx.pos.Position.x;
+		particle.y += fx.pos.Position.y;
+		particle.z += fx.pos.Position.z;
+	}
+	else if ((particle.flags & SP_ITEM) && (particle.flags & SP_NODEATTACH))
+	{
+		if ((particle.sLife - particle.life) <= GenerateInt(4, 8))
+			return;
+
+		const auto& nodeOffset = NodeOffsets[particle.nodeNumber];
+		auto nodePos = Vector3i(nodeOffset.x, nodeOffset.y, nodeOffset.z);
+
+		if (nodeOffset.meshNum >= 0)
+			nodePos = GetJointPosition(&g_Level.Items[particle.fxObj], nodeOffset.meshNum, nodePos);
+		else
+			nodePos = GetJointPosition(LaraItem, -nodeOffset.meshNum, nodePos);
+
+		particle.flags &= ~SP_ITEM;
+		particle.x += nodePos.x;
+		particle.y += nodePos.y;
+		particle.z += nodePos.z;
+	}
+}
+
 void UpdateSparks()
 {
 	auto bounds = GameBoundingBox(LaraItem);
@@ -203,9 +226,9 @@ void UpdateSparks()
 		LaraItem->Pose.Position.z + bounds.Z1,
 		LaraItem->Pose.Position.z + bounds.Z2);
 
-	for (int i = 0; i < MAX_PARTICLES; i++)
+	for (int i = 0; i < ParticlePool.GetCount(); i++)
 	{
-		auto* spark = &Particles[i];
+		auto* spark = &Particles[ParticlePool[i]];
 
 		if (spark->on)
 		{
@@ -338,6 +361,8 @@ void UpdateSparks()
 				spark->z += Weather.Wind().z;
 			}
 
+			DetachParticle(*spark);
+
 			int dl = ((spark->sLife - spark->life) * 65536) / spark->sLife;
 			spark->size = (spark->sSize + ((dl * (spark->dSize - spark->sSize)) / 65536));
 		
@@ -371,9 +396,9 @@ void UpdateSparks()
 		}
 	}
 
-	for (int i = 0; i < MAX_PARTICLES; i++)
+	for (int i = 0; i < ParticlePool.GetCount(); i++)
 	{
-		auto* spark = &Particles[i];
+		auto* spark = &Particles[ParticlePool[i]];
 
 		if (spark->on && spark->dynamic != -1)
 		{
@@ -450,6 +475,8 @@ void UpdateSparks()
 			}
 		}
 	}
+
+	ParticlePool.Sweep([](int slot) { return Particles[slot].on; });
 }
 
 void TriggerRicochetSpark(const GameVector& pos, short angle, int count, int unk)
@@ -467,7 +494,7 @@ void TriggerCyborgSpark(int x, int y, int z, short xv, short yv, short zv)
 	{
 		auto* spark = GetFreeParticle();
 
-		int random = rand();
+		int random = GetRandomControl();
 		
 		spark->sR = -1;
 		spark->sB = -1;
@@ -1731,7 +1758,7 @@ void TriggerMetalSparks(int x, int y, int z, int xv, int yv, int zv, const Vecto
 
 	if (dx >= -16384 && dx <= 16384 && dz >= -16384 && dz <= 16384)
 	{
-		int r = rand();
+		int r = GetRandomControl();
 
 		auto* spark = GetFreeParticle();
 
@@ -1764,7 +1791,7 @@ void TriggerMetalSparks(int x, int y, int z, int xv, int yv, int zv, const Vecto
 
 		if (additional)
 		{
-			r = rand();
+			r = GetRandomControl();
 			spark = GetFreeParticle();
 			spark->on = 1;
 			spark->sR = spark->dR >> 1;
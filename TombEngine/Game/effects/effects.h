@@ -247,6 +247,7 @@ void ClearInactiveEffects(std::vector<TEffect>& effects)
 		effects.end());
 }
 
+void RebuildParticlePool();
 Particle* GetFreeParticle();
 
 void SetSpriteSequence(Particle& particle, GAME_OBJECT_ID objectID);
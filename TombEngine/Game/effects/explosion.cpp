@@ -1,6 +1,7 @@
 #include "framework.h"
 #include "Game/effects/explosion.h"
 
+#include "Game/control/control.h"
 #include "Game/effects/effects.h"
 #include "Game/effects/spark.h"
 #include "Game/effects/tomb4fx.h"
@@ -36,7 +37,7 @@ namespace TEN::Effects::Explosion
 		if (triggerShockwave)
 		{
 			auto shockPos = Pose(Vector3i(pos));
-			TriggerShockwave(&shockPos, 0, size, 64, 32, 32, 32, 30, EulerAngles(rand() & 0xFFFF, 0.0f, 0.0f), 0, true, false, false, (int)ShockwaveStyle::Normal);
+			TriggerShockwave(&shockPos, 0, size, 64, 32, 32, 32, 30, EulerAngles(GetRandomControl() & 0xFFFF, 0.0f, 0.0f), 0, true, false, false, (int)ShockwaveStyle::Normal);
 		}
 	}
 
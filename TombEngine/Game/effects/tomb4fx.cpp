@@ -21,6 +21,7 @@
 #include "Renderer/Renderer.h"
 #include "Sound/sound.h"
 #include "Specific/level.h"
+#include "Specific/memory/FixedPool.h"
 
 using namespace TEN::Effects::Bubble;
 using namespace TEN::Effects::Drip;
@@ -30,6 +31,7 @@ using namespace TEN::Effects::Smoke;
 using namespace TEN::Collision::Floordata;
 using namespace TEN::Collision::Point;
 using namespace TEN::Math;
+using namespace TEN::Memory;
 using TEN::Renderer::g_Renderer;
 
 // NOTE: This fixes body part exploding instantly if entity is on ground.
@@ -43,11 +45,6 @@ int LaserSightX;
 int LaserSightY;
 int LaserSightZ;
 
-int NextFireSpark = 1;
-int NextSmokeSpark = 0;
-int NextBlood = 0;
-int NextGunShell = 0;
-
 FIRE_SPARKS FireSparks[MAX_SPARKS_FIRE];
 SMOKE_SPARKS SmokeSparks[MAX_SPARKS_SMOKE];
 GUNSHELL_STRUCT Gunshells[MAX_GUNSHELL];
@@ -55,46 +52,25 @@ BLOOD_STRUCT Blood[MAX_SPARKS_BLOOD];
 SHOCKWAVE_STRUCT ShockWaves[MAX_SHOCKWAVE];
 FIRE_LIST Fires[MAX_FIRE_LIST];
 
-int GetFreeFireSpark()
-{
-	int sparkNum = NextFireSpark;
-	int minIndex = 0;
-	int minLife = 4095;
-	int i = 0;
-
-	FIRE_SPARKS* spark = &FireSparks[NextFireSpark];
-	while (spark->on)
-	{
-		if (spark->life < minLife)
-		{
-			minIndex = sparkNum;
-			minLife = spark->life;
-		}
-		if (sparkNum == MAX_SPARKS_FIRE - 1)
-		{
-			spark = &FireSparks[1];
-			sparkNum = 1;
-		}
-		else
-		{
-			sparkNum++;
-			spark++;
-		}
-
-		if (++i >= MAX_SPARKS_FIRE)
-		{
-			NextFireSpark = minIndex + 1;
-			if (NextFireSpark >= MAX_SPARKS_FIRE)
-				NextFireSpark = 1;
-			return minIndex;
-		}
-	}
+// Slot pools for effect arrays. When full, oldest effect is replaced.
+static auto FireSparkPool  = FixedPool<MAX_SPARKS_FIRE>(1); // Slot 0 is reserved for global static flame.
+static auto SmokeSparkPool = FixedPool<MAX_SPARKS_SMOKE>();
+static auto BloodPool	   = FixedPool<MAX_SPARKS_BLOOD>();
+static auto GunshellPool   = FixedPool<MAX_GUNSHELL>();
+static auto ShockwavePool  = FixedPool<MAX_SHOCKWAVE>();
 
-	NextFireSpark = sparkNum + 1;
-	if (sparkNum + 1 >= MAX_SPARKS_FIRE)
-		NextFireSpark = 1;
+void RebuildEffectPools()
+{
+	FireSparkPool.Rebuild([](int slot) { return FireSparks[slot].on; });
+	SmokeSparkPool.Rebuild([](int slot) { return SmokeSparks[slot].on; });
+	BloodPool.Rebuild([](int slot) { return Blood[slot].on; });
+	GunshellPool.Rebuild([](int slot) { return (Gunshells[slot].counter != 0); });
+	ShockwavePool.Rebuild([](int slot) { return (ShockWaves[slot].life > 0); });
+}
 
-	return sparkNum;
+int GetFreeFireSpark()
+{
+	return FireSparkPool.AllocateOrEvict();
 }
 
 void TriggerGlobalStaticFlame()
@@ -402,9 +378,9 @@ void UpdateFireSparks()
 {
 	UpdateFireProgress();
 
-	for (int i = 0; i < MAX_SPARKS_FIRE; i++)
+	for (int i = 0; i < FireSparkPool.GetCount(); i++)
 	{
-		FIRE_SPARKS* spark = &FireSparks[i];
+		FIRE_SPARKS* spark = &FireSparks[FireSparkPool[i]];
 
 		if (spark->on)
 		{
@@ -474,51 +450,20 @@ void UpdateFireSparks()
 			spark->size = spark->sSize + ((dl * (spark->dSize - spark->sSize)) / 65536);
 		}
 	}
+
+	FireSparkPool.Sweep([](int slot) { return FireSparks[slot].on; });
 }
 
-int GetFreeSmokeSpark() 
+int GetFreeSmokeSpark()
 {
-	SMOKE_SPARKS* spark = &SmokeSparks[NextSmokeSpark];
-	int sparkNum = NextSmokeSpark;
-	short minLife = 4095;
-	short minIndex = 0;
-	short count = 0;
-	while (spark->on)
-	{
-		if (spark->life < minLife)
-		{
-			minIndex = sparkNum;
-			minLife = spark->life;
-		}
-
-		if (sparkNum == MAX_SPARKS_SMOKE - 1)
-		{
-			spark = &SmokeSparks[0];
-			sparkNum = 0;
-		}
-		else
-		{
-			sparkNum++;
-			spark++;
-		}
-
-		if (++count >= MAX_SPARKS_SMOKE)
-		{
-			NextSmokeSpark = (minIndex + 1) % MAX_SPARKS_SMOKE;
-			return minIndex;
-		}
-	}
-
-	NextSmokeSpark = (sparkNum + 1) % MAX_SPARKS_SMOKE;
-
-	return sparkNum;
+	return SmokeSparkPool.AllocateOrEvict();
 }
 
 void UpdateSmoke()
 {
-	for (int i = 0; i < MAX_SPARKS_SMOKE; i++)
+	for (int i = 0; i < SmokeSparkPool.GetCount(); i++)
 	{
-		SMOKE_SPARKS* spark = &SmokeSparks[i];
+		SMOKE_SPARKS* spark = &SmokeSparks[SmokeSparkPool[i]];
 
 		if (spark->on)
 		{
@@ -612,6 +557,8 @@ void UpdateSmoke()
 			spark->size = spark->sSize + (dl * (spark->dSize - spark->sSize) >> 16);
 		}
 	}
+
+	SmokeSparkPool.Sweep([](int slot) { return SmokeSparks[slot].on; });
 }
 
 byte TriggerGunSmoke_SubFunction(LaraWeaponType weaponType)
@@ -680,40 +627,7 @@ void TriggerShatterSmoke(int x, int y, int z)
 
 int GetFreeBlood()
 {
-	BLOOD_STRUCT* blood = &Blood[NextBlood];
-	int bloodNum = NextBlood;
-	int minLife = 4095;
-	int minIndex = 0;
-	int count = 0;
-
-	while (blood->on)
-	{
-		if (blood->life < minLife)
-		{
-			minIndex = bloodNum;
-			minLife = blood->life;
-		}
-
-		if (bloodNum == MAX_SPARKS_BLOOD - 1)
-		{
-			blood = &Blood[0];
-			bloodNum = 0;
-		}
-		else
-		{
-			blood++;
-			bloodNum++;
-		}
-
-		if (++count >= MAX_SPARKS_BLOOD)
-		{
-			NextBlood = (minIndex + 1) & 31;
-			return minIndex;
-		}
-	}
-
-	NextBlood = (bloodNum + 1) & 31;
-	return bloodNum;
+	return BloodPool.AllocateOrEvict();
 }
 
 void TriggerBlood(int x, int y, int z, int unk, int num)
@@ -749,9 +663,9 @@ void TriggerBlood(int x, int y, int z, int unk, int num)
 
 void UpdateBlood()
 {
-	for (int i = 0; i < MAX_SPARKS_BLOOD; i++)
+	for (int i = 0; i < BloodPool.GetCount(); i++)
 	{
-		BLOOD_STRUCT* blood = &Blood[i];
+		BLOOD_STRUCT* blood = &Blood[BloodPool[i]];
 
 		if (blood->on)
 		{
@@ -802,52 +716,13 @@ void UpdateBlood()
 			blood->size = blood->sSize + (dl * (blood->dSize - blood->sSize) >> 16);
 		}
 	}
+
+	BloodPool.Sweep([](int slot) { return Blood[slot].on; });
 }
 
 int GetFreeGunshell()
 {
-	int gsNum = NextGunShell;
-	int minLife = 4095;
-	int minIndex = 0;
-	int i = 0;
-
-	while (true)
-	{
-		GUNSHELL_STRUCT* gs = &Gunshells[NextGunShell];
-
-		if (!gs->counter)
-			break;
-
-		if (gs->counter < minLife)
-		{
-			minLife = gs->counter;
-			minIndex = gsNum;
-		}
-		if (gsNum == MAX_GUNSHELL - 1)
-		{
-			gs = &Gunshells[0];
-			gsNum = 0;
-		}
-		else
-		{
-			gsNum++;
-			gs++;
-		}
-
-		if (++i >= MAX_GUNSHELL)
-		{
-			NextGunShell = minIndex + 1;
-			if (minIndex + 1 >= MAX_GUNSHELL)
-				NextGunShell = 0;
-			return minIndex;
-		}
-	}
-
-	NextGunShell = gsNum + 1;
-	if (gsNum + 1 >= MAX_GUNSHELL)
-		NextGunShell = 0;
-
-	return gsNum;
+	return GunshellPool.AllocateOrEvict();
 }
 
 void TriggerGunShell(short hand, short objNum, LaraWeaponType weaponType)
@@ -947,9 +822,9 @@ void TriggerGunShell(short hand, short objNum, LaraWeaponType weaponType)
 
 void UpdateGunShells()
 {
-	for (int i = 0; i < MAX_GUNSHELL; i++)
+	for (int i = 0; i < GunshellPool.GetCount(); i++)
 	{
-		auto* gunshell = &Gunshells[i];
+		auto* gunshell = &Gunshells[GunshellPool[i]];
 
 		if (gunshell->counter)
 		{
@@ -1039,6 +914,8 @@ void UpdateGunShells()
 			}
 		}
 	}
+
+	GunshellPool.Sweep([](int slot) { return (Gunshells[slot].counter != 0); });
 }
 
 void AddWaterSparks(int x, int y, int z, int num)
@@ -1253,13 +1130,8 @@ void ExplodingDeath(short itemNumber, short flags)
 
 int GetFreeShockwave()
 {
-	for (int i = 0; i < MAX_SHOCKWAVE; i++)
-	{
-		if (!ShockWaves[i].life)
-			return i;
-	}
-
-	return -1;
+	// Shockwave is dropped only if all slots are alive, as before pool was used.
+	return ShockwavePool.AllocateOrReclaim([](int slot) { return (ShockWaves[slot].life > 0); });
 }
 
 void TriggerShockwave(Pose* pos, short innerRad, short outerRad, int speed, unsigned char r, unsigned char g, unsigned char b, unsigned char life, EulerAngles rotation, short damage, bool hasSound, bool fadein, bool hasLight, int style)
@@ -1357,8 +1229,9 @@ void TriggerShockwaveHitEffect(int x, int y, int z, unsigned char r, unsigned ch
 
 void UpdateShockwaves()
 {
-	for (auto& shockwave : ShockWaves)
+	for (int i = 0; i < ShockwavePool.GetCount(); i++)
 	{
+		auto& shockwave = ShockWaves[ShockwavePool[i]];
 		if (shockwave.life <= 0)
 			continue;
 
@@ -1416,6 +1289,8 @@ void UpdateShockwaves()
 			}
 		}
 	}
+
+	ShockwavePool.Sweep([](int slot) { return (ShockWaves[slot].life > 0); });
 }
 
 void TriggerExplosionBubble(int x, int y, int z, short roomNumber)
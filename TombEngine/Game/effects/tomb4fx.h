@@ -202,11 +202,7 @@ extern int LaserSightZ;
 extern char LaserSightActive;
 extern char LaserSightCol;
 
-extern int NextFireSpark;
-extern int NextSmokeSpark;
-extern int NextBlood;
 extern int NextSpider;
-extern int NextGunShell;
 
 constexpr auto MAX_SPARKS_FIRE = 20;
 constexpr auto MAX_FIRE_LIST = 32;
@@ -223,6 +219,7 @@ extern BLOOD_STRUCT Blood[MAX_SPARKS_BLOOD];
 extern SHOCKWAVE_STRUCT ShockWaves[MAX_SHOCKWAVE];
 extern FIRE_LIST Fires[MAX_FIRE_LIST];
 
+void RebuildEffectPools();
 void TriggerBlood(int x, int y, int z, int unk, int num);
 void TriggerExplosionBubble(int x, int y, int z, short roomNumber);
 int GetFreeFireSpark();
@@ -153,8 +153,9 @@ struct CreatureInfo
 
 	bool IsTargetAlive();
 
-#ifdef CREATURE_AI_PRIORITY_OPTIMIZATION
-	CreatureAIPriority Priority = CreatureAIPriority::None;
-	size_t FramesSinceLOTUpdate = 0;
-#endif
+	// AI level of detail, see CreatureScheduler.
+	CreatureAIPriority Priority			   = CreatureAIPriority::High;
+	int				   FramesSinceAIUpdate = 0;
+	int				   LodFrame			   = -1;
+	bool			   IsAIUpdateDue	   = true;
 };
@@ -1,10 +1,15 @@
 #include "framework.h"
 #include "Game/items.h"
 
+#include <chrono>
+
 #include "Game/collision/floordata.h"
 #include "Game/collision/collide_room.h"
 #include "Game/collision/Point.h"
+#include "Game/collision/Sphere.h"
 #include "Game/control/control.h"
+#include "Game/control/CreatureScheduler.h"
+#include "Game/control/CreatureSensing.h"
 #include "Game/control/volume.h"
 #include "Game/effects/effects.h"
 #include "Game/effects/item_fx.h"
@@ -30,6 +35,9 @@
 using namespace TEN::Collision::Floordata;
 using namespace TEN::Collision::Point;
 using namespace TEN::Collision::Room;
+using namespace TEN::Collision::Sphere;
+using namespace TEN::Control::Scheduler;
+using namespace TEN::Control::Sensing;
 using namespace TEN::Control::Volumes;
 using namespace TEN::Effects::Items;
 using namespace TEN::Entities::Generic;
@@ -40,6 +48,10 @@ using TEN::Renderer::g_Renderer;
 
 constexpr auto ITEM_DEATH_TIMEOUT = 4 * FPS;
 
+// Item numbers bucketed by object ID. Buckets are unordered; IndexedObjectIDs holds the bucket each item is stored in.
+static auto ObjectItemNumbers = std::vector<std::vector<int>>{};
+static auto IndexedObjectIDs  = std::vector<GAME_OBJECT_ID>{};
+
 bool ItemInfo::TestOcb(short ocbFlags) const
 {
 	return ((TriggerFlags & ocbFlags) == ocbFlags);
@@ -184,9 +196,9 @@ bool ItemInfo::IsBridge() const
 	return Contains(BRIDGE_OBJECT_IDS, ObjectNumber);
 }
 
-std::vector<BoundingSphere> ItemInfo::GetSpheres() const
+const std::vector<BoundingSphere>& ItemInfo::GetSpheres() const
 {
-	return g_Renderer.GetSpheres(Index);
+	return GetItemSpheres(*this);
 }
 
 bool TestState(int refState, const std::vector<int>& stateList)
@@ -219,6 +231,96 @@ static void GameScriptHandleKilled(short itemNumber, bool destroyed)
 	}
 }
 
+// Bridge surfaces depend on pose, animation frame and object-specific item flags (e.g. raising block height).
+struct BridgeSurfaceState
+{
+	Pose Pose		= Pose::Zero;
+	int	 AnimNumber	= NO_VALUE;
+	int	 FrameNumber = NO_VALUE;
+	std::array<short, ITEM_FLAG_COUNT> ItemFlags = {};
+
+	bool operator ==(const BridgeSurfaceState& state) const
+	{
+		return (Pose == state.Pose && AnimNumber == state.AnimNumber && FrameNumber == state.FrameNumber && ItemFlags == state.ItemFlags);
+	}
+
+	bool operator !=(const BridgeSurfaceState& state) const
+	{
+		return !(*this == state);
+	}
+};
+
+static BridgeSurfaceState GetBridgeSurfaceState(const ItemInfo& item)
+{
+	return BridgeSurfaceState{ item.Pose, item.Animation.AnimNumber, item.Animation.FrameNumber, item.ItemFlags };
+}
+
+static void RemoveItemFromObjectIndex(int itemNumber)
+{
+	if (itemNumber < 0 || itemNumber >= IndexedObjectIDs.size())
+		return;
+
+	auto objectID = IndexedObjectIDs[itemNumber];
+	if (objectID == ID_NO_OBJECT)
+		return;
+
+	auto& itemNumbers = ObjectItemNumbers[objectID];
+	auto it = std::find(itemNumbers.begin(), itemNumbers.end(), itemNumber);
+	if (it != itemNumbers.end())
+	{
+		*it = itemNumbers.back();
+		itemNumbers.pop_back();
+	}
+
+	IndexedObjectIDs[itemNumber] = ID_NO_OBJECT;
+}
+
+// Must be called whenever ObjectNumber of a live item changes, so that slot lookups stay in sync.
+void UpdateItemObjectIndex(int itemNumber)
+{
+	if (itemNumber < 0 || itemNumber >= IndexedObjectIDs.size())
+		return;
+
+	auto objectID = g_Level.Items[itemNumber].ObjectNumber;
+	if (IndexedObjectIDs[itemNumber] == objectID)
+		return;
+
+	RemoveItemFromObjectIndex(itemNumber);
+	if (objectID <= ID_NO_OBJECT || objectID >= ID_NUMBER_OBJECTS)
+		return;
+
+	ObjectItemNumbers[objectID].push_back(itemNumber);
+	IndexedObjectIDs[itemNumber] = objectID;
+}
+
+void RebuildItemObjectIndex()
+{
+	ObjectItemNumbers.assign(ID_NUMBER_OBJECTS, {});
+	IndexedObjectIDs.assign(g_Level.Items.size(), ID_NO_OBJECT);
+
+	// Skip free dynamic item slots, as they keep object ID of last spawned item.
+	auto isFree = std::vector<bool>(g_Level.Items.size(), false);
+	for (int itemNumber = NextItemFree; itemNumber != NO_VALUE; itemNumber = g_Level.Items[itemNumber].NextItem)
+		isFree[itemNumber] = true;
+
+	for (int i = 0; i < g_Level.Items.size(); i++)
+	{
+		if (!isFree[i])
+			UpdateItemObjectIndex(i);
+	}
+}
+
+// Returns level and spawned items currently using given object ID, including killed level items, in no particular order.
+const std::vector<int>& GetItemNumbersByObjectID(GAME_OBJECT_ID objectID)
+{
+	static const auto EMPTY_ITEM_NUMBERS = std::vector<int>{};
+
+	if (objectID <= ID_NO_OBJECT || objectID >= ObjectItemNumbers.size())
+		return EMPTY_ITEM_NUMBERS;
+
+	return ObjectItemNumbers[objectID];
+}
+
 void KillItem(short const itemNumber)
 {
 	if (InItemControlLoop)
@@ -282,6 +384,7 @@ void KillItem(short const itemNumber)
 
 		if (itemNumber >= g_Level.NumItems)
 		{
+			RemoveItemFromObjectIndex(itemNumber);
 			item->NextItem = NextItemFree;
 			NextItemFree = itemNumber;
 		}
@@ -538,6 +641,8 @@ void InitializeItem(short itemNumber)
 {
 	auto* item = &g_Level.Items[itemNumber];
 
+	UpdateItemObjectIndex(itemNumber);
+
 	SetAnimation(item, 0);
 	item->Animation.RequiredState = NO_VALUE;
 	item->Animation.Velocity = Vector3::Zero;
@@ -621,6 +726,11 @@ void InitializeItemArray(int totalItem)
 	for (int i = 0; i < totalItem; i++)
 		g_Level.Items[i].Index = i;
 
+	ObjectItemNumbers.assign(ID_NUMBER_OBJECTS, {});
+	IndexedObjectIDs.assign(totalItem, ID_NO_OBJECT);
+	InitializeBridgeCache();
+	InitializeItemSphereCache();
+
 	auto* item = &g_Level.Items[g_Level.NumItems];
 
 	if (g_Level.NumItems + 1 < totalItem)
@@ -675,6 +785,7 @@ int GlobalItemReplace(short search, GAME_OBJECT_ID replace)
 			if (g_Level.Items[itemNumber].ObjectNumber == search)
 			{
 				g_Level.Items[itemNumber].ObjectNumber = replace;
+				UpdateItemObjectIndex(itemNumber);
 				changed++;
 			}
 		}
@@ -699,12 +810,13 @@ std::vector<int> FindAllItems(GAME_OBJECT_ID objectID)
 {
 	auto itemNumbers = std::vector<int>{};
 
-	for (int i = 0; i < g_Level.NumItems; i++)
+	for (int itemNumber : GetItemNumbersByObjectID(objectID))
 	{
-		if (g_Level.Items[i].ObjectNumber == objectID)
-			itemNumbers.push_back(i);
+		if (itemNumber < g_Level.NumItems)
+			itemNumbers.push_back(itemNumber);
 	}
 
+	std::sort(itemNumbers.begin(), itemNumbers.end());
 	return itemNumbers;
 }
 
@@ -712,19 +824,14 @@ std::vector<int> FindCreatedItems(GAME_OBJECT_ID objectID)
 {
 	auto itemNumbers = std::vector<int>{};
 
-	if (NextItemActive == NO_VALUE)
-		return itemNumbers;
-
-	const auto* itemPtr = &g_Level.Items[NextItemActive];
-
-	for (int nextActive = NextItemActive; nextActive != NO_VALUE; nextActive = itemPtr->NextActive)
+	for (int itemNumber : GetItemNumbersByObjectID(objectID))
 	{
-		itemPtr = &g_Level.Items[nextActive];
-
-		if (itemPtr->ObjectNumber == objectID)
-			itemNumbers.push_back(nextActive);
+		if (g_Level.Items[itemNumber].Active)
+			itemNumbers.push_back(itemNumber);
 	}
 
+	// NOTE: Returned in item number order, not active list order. Index order depends on removal history.
+	std::sort(itemNumbers.begin(), itemNumbers.end());
 	return itemNumbers;
 }
 
@@ -757,6 +864,9 @@ void UpdateAllItems()
 {
 	InItemControlLoop = true;
 
+	// Sense all creatures before any of them moves.
+	SenseCreatures();
+
 	short itemNumber = NextItemActive;
 	while (itemNumber != NO_VALUE)
 	{
@@ -769,8 +879,28 @@ void UpdateAllItems()
 		if (item->AfterDeath <= ITEM_DEATH_TIMEOUT)
 		{
 			if (Objects[item->ObjectNumber].control)
+			{
+				bool isCreature = item->IsCreature();
+				bool isBridge = item->IsBridge();
+				auto bridgeState = isBridge ? GetBridgeSurfaceState(*item) : BridgeSurfaceState{};
+				auto time0 = std::chrono::high_resolution_clock::now();
+
 				Objects[item->ObjectNumber].control(itemNumber);
 
+				// Probes cached earlier in frame are stale once bridge surface has moved, even within same sector.
+				if (isBridge && GetBridgeSurfaceState(*item) != bridgeState)
+					InvalidatePointCollisionCache();
+
+				if (isCreature)
+				{
+					auto time1 = std::chrono::high_resolution_clock::now();
+					double time = std::chrono::duration<double, std::micro>(time1 - time0).count();
+
+					AddCreatureControlTime(time);
+					AddCreatureLodControlTime(*item, time);
+				}
+			}
+
 			TestVolumes(itemNumber);
 			ProcessEffects(item);
 
@@ -179,7 +179,7 @@ struct ItemInfo
 
 	// Getters
 
-	std::vector<BoundingSphere> GetSpheres() const;
+	const std::vector<BoundingSphere>& GetSpheres() const;
 };
 
 bool TestState(int refState, const std::vector<int>& stateList);
@@ -200,6 +200,9 @@ bool UpdateItemRoom(short itemNumber);
 void UpdateAllItems();
 void UpdateAllEffects();
 const std::string& GetObjectName(GAME_OBJECT_ID objectID);
+void UpdateItemObjectIndex(int itemNumber);
+void RebuildItemObjectIndex();
+const std::vector<int>& GetItemNumbersByObjectID(GAME_OBJECT_ID objectID);
 std::vector<int> FindAllItems(GAME_OBJECT_ID objectID);
 std::vector<int> FindCreatedItems(GAME_OBJECT_ID objectID);
 ItemInfo* FindItem(GAME_OBJECT_ID objectID);
@@ -2,6 +2,7 @@
 #include "Game/people.h"
 
 #include "Game/animation.h"
+#include "Game/control/CreatureSensing.h"
 #include "Game/control/los.h"
 #include "Game/effects/effects.h"
 #include "Game/effects/debris.h"
@@ -11,6 +12,8 @@
 #include "Game/misc.h"
 #include "Sound/sound.h"
 
+using namespace TEN::Control::Sensing;
+
 bool ShotLara(ItemInfo* item, AI_INFO* AI, const CreatureBiteInfo& gun, short extraRotation, int damage)
 {
 	auto* creature = GetCreatureInfo(item);
@@ -132,13 +135,15 @@ bool Targetable(ItemInfo* item, AI_INFO* ai)
 		enemy->Pose.Position.z,
 		enemy->RoomNumber); // TODO: Check why this line didn't exist in the first place. -- TokyoSU 2022.08.05
 
-	MESH_INFO* mesh = nullptr;
-	Vector3i vector = {};
-	int losItemIndex = ObjectOnLOS2(&origin, &target, &vector, &mesh);
+	// Objects are tested in rooms this ray traverses.
+	auto ray = LosRay{ origin, target };
+	GetLos(ray, true);
+
+	int losItemIndex = ray.ObjectIndex;
 	if (losItemIndex == item->Index)
 		losItemIndex = NO_LOS_ITEM; // Don't find itself
 
-	return (LOS(&origin, &target) && losItemIndex == NO_LOS_ITEM && mesh == nullptr);
+	return (ray.IsClear && losItemIndex == NO_LOS_ITEM && ray.StaticPtr == nullptr);
 }
 
 bool TargetVisible(ItemInfo* item, AI_INFO* ai, float maxAngleInDegrees)
@@ -158,20 +163,30 @@ bool TargetVisible(ItemInfo* item, AI_INFO* ai, float maxAngleInDegrees)
 	short angle = ai->angle - creature->JointRotation[2];
 	if (angle > ANGLE(-maxAngleInDegrees) && angle < ANGLE(maxAngleInDegrees))
 	{
-		const auto& bounds = GetBestFrame(*enemy).BoundingBox;
-
-		auto origin = GameVector(
-			item->Pose.Position.x,
-			item->Pose.Position.y - CLICK(3),
-			item->Pose.Position.z,
-			item->RoomNumber);
-		auto target = GameVector(
-			enemy->Pose.Position.x,
-			enemy->Pose.Position.y + ((((bounds.Y1 * 2) + bounds.Y1) + bounds.Y2) / 4),
-			enemy->Pose.Position.z);
-
-		return LOS(&origin, &target);
+		// Use line of sight from sensing phase if still valid.
+		auto isVisible = GetSensedTargetVisibility(*item);
+		if (isVisible.has_value())
+			return *isVisible;
+
+		return TestTargetLos(item, enemy);
 	}
 
 	return false;
 }
+
+bool TestTargetLos(ItemInfo* item, ItemInfo* enemy)
+{
+	const auto& bounds = GetBestFrame(*enemy).BoundingBox;
+
+	auto origin = GameVector(
+		item->Pose.Position.x,
+		item->Pose.Position.y - CLICK(3),
+		item->Pose.Position.z,
+		item->RoomNumber);
+	auto target = GameVector(
+		enemy->Pose.Position.x,
+		enemy->Pose.Position.y + ((((bounds.Y1 * 2) + bounds.Y1) + bounds.Y2) / 4),
+		enemy->Pose.Position.z);
+
+	return LOS(&origin, &target);
+}
@@ -6,6 +6,7 @@
 #include "Game/control/control.h"
 #include "Game/control/lot.h"
 #include "Game/control/volume.h"
+#include "Game/effects/debris.h"
 #include "Game/items.h"
 #include "Renderer/Renderer.h"
 #include "Math/Math.h"
@@ -18,12 +19,27 @@ using namespace TEN::Collision::Point;
 using namespace TEN::Renderer;
 using namespace TEN::Utils;
 
+constexpr auto ROOM_GRID_CELL_SIZE = BLOCK(4);
+
 bool FlipStatus = false;
 bool FlipStats[MAX_FLIPMAP];
 int  FlipMap[MAX_FLIPMAP];
 
 std::vector<short> OutsideRoomTable[OUTSIDE_SIZE][OUTSIDE_SIZE];
 
+// Uniform XZ grid over room interiors used by FindRoomNumber() when neighbor search fails.
+// Stored in compressed form: RoomGridCellOffsets[cellID] .. RoomGridCellOffsets[cellID + 1] span RoomGridRoomNumbers.
+// Room numbers within cell are ascending, so first match equals that of linear room scan.
+static auto RoomGridOrigin		= Vector2i::Zero;
+static int	RoomGridWidth		= 0;
+static int	RoomGridDepth		= 0;
+static auto RoomGridCellOffsets = std::vector<int>{};
+static auto RoomGridRoomNumbers = std::vector<int>{};
+
+// Neighbor rooms of all rooms in single contiguous table. Each room's NeighborRoomNumbers spans its own range.
+// Spans are swapped together with rooms on flipmap, so table itself is only built on level load.
+static auto NeighborRoomTable = std::vector<int>{};
+
 bool ROOM_INFO::Active() const
 {
 	if (flipNumber == NO_VALUE)
@@ -94,6 +110,7 @@ void DoFlipMap(int group)
 			RemoveRoomFlipItems(room);
 
 			// Swap rooms.
+			// NOTE: Neighbor room spans are swapped along, so neighbor room table needs no rebuild.
 			std::swap(room, flippedRoom);
 			room.flippedRoom = flippedRoom.flippedRoom;
 			flippedRoom.flippedRoom = NO_VALUE;
@@ -117,6 +134,11 @@ void DoFlipMap(int group)
 	FlipStatus =
 	FlipStats[group] = !FlipStats[group];
 
+	// Swapped rooms may differ in bounds.
+	InitializeRoomGrid();
+	InvalidatePointCollisionCache();
+	InvalidateDebrisSectors();
+
 	for (auto& creature : ActiveCreatures)
 		creature->LOT.TargetBox = NO_VALUE;
 }
@@ -229,6 +251,70 @@ bool IsPointInRoom(const Vector3i& pos, int roomNumber)
 	return false;
 }
 
+static std::pair<Vector2i, Vector2i> GetRoomGridCellRange(const ROOM_INFO& room)
+{
+	// Match interior bounds tested by IsPointInRoom().
+	auto minCell = Vector2i(
+		(room.Position.x + BLOCK(1) - RoomGridOrigin.x) / ROOM_GRID_CELL_SIZE,
+		(room.Position.z + BLOCK(1) - RoomGridOrigin.y) / ROOM_GRID_CELL_SIZE);
+	auto maxCell = Vector2i(
+		(room.Position.x + BLOCK(room.XSize - 1) - RoomGridOrigin.x) / ROOM_GRID_CELL_SIZE,
+		(room.Position.z + BLOCK(room.ZSize - 1) - RoomGridOrigin.y) / ROOM_GRID_CELL_SIZE);
+
+	return { minCell, maxCell };
+}
+
+void InitializeRoomGrid()
+{
+	RoomGridCellOffsets.clear();
+	RoomGridRoomNumbers.clear();
+	RoomGridWidth = RoomGridDepth = 0;
+
+	if (g_Level.Rooms.empty())
+		return;
+
+	auto minPos = Vector2i(INT_MAX, INT_MAX);
+	auto maxPos = Vector2i(INT_MIN, INT_MIN);
+	for (const auto& room : g_Level.Rooms)
+	{
+		minPos.x = std::min(minPos.x, room.Position.x);
+		minPos.y = std::min(minPos.y, room.Position.z);
+		maxPos.x = std::max(maxPos.x, room.Position.x + BLOCK(room.XSize));
+		maxPos.y = std::max(maxPos.y, room.Position.z + BLOCK(room.ZSize));
+	}
+
+	RoomGridOrigin = minPos;
+	RoomGridWidth = ((maxPos.x - minPos.x) / ROOM_GRID_CELL_SIZE) + 1;
+	RoomGridDepth = ((maxPos.y - minPos.y) / ROOM_GRID_CELL_SIZE) + 1;
+
+	// Count rooms per cell, then fill in room order to keep cells sorted.
+	RoomGridCellOffsets.resize((RoomGridWidth * RoomGridDepth) + 1, 0);
+	for (const auto& room : g_Level.Rooms)
+	{
+		auto [minCell, maxCell] = GetRoomGridCellRange(room);
+		for (int x = minCell.x; x <= maxCell.x; x++)
+		{
+			for (int z = minCell.y; z <= maxCell.y; z++)
+				RoomGridCellOffsets[(x * RoomGridDepth) + z + 1]++;
+		}
+	}
+
+	for (int i = 1; i < RoomGridCellOffsets.size(); i++)
+		RoomGridCellOffsets[i] += RoomGridCellOffsets[i - 1];
+
+	auto cellCursors = std::vector<int>(RoomGridCellOffsets.begin(), RoomGridCellOffsets.end() - 1);
+	RoomGridRoomNumbers.resize(RoomGridCellOffsets.back());
+	for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+	{
+		auto [minCell, maxCell] = GetRoomGridCellRange(g_Level.Rooms[roomNumber]);
+		for (int x = minCell.x; x <= maxCell.x; x++)
+		{
+			for (int z = minCell.y; z <= maxCell.y; z++)
+				RoomGridRoomNumbers[cellCursors[(x * RoomGridDepth) + z]++] = roomNumber;
+		}
+	}
+}
+
 int FindRoomNumber(const Vector3i& pos, int startRoomNumber)
 {
 	if (startRoomNumber != NO_VALUE && startRoomNumber < g_Level.Rooms.size())
@@ -245,10 +331,18 @@ int FindRoomNumber(const Vector3i& pos, int startRoomNumber)
 		}
 	}
 
-	for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+	int cellX = (pos.x - RoomGridOrigin.x) / ROOM_GRID_CELL_SIZE;
+	int cellZ = (pos.z - RoomGridOrigin.y) / ROOM_GRID_CELL_SIZE;
+	if (pos.x >= RoomGridOrigin.x && pos.z >= RoomGridOrigin.y &&
+		cellX < RoomGridWidth && cellZ < RoomGridDepth)
 	{
-		if (IsPointInRoom(pos, roomNumber) && g_Level.Rooms[roomNumber].Active())
-			return roomNumber;
+		int cellID = (cellX * RoomGridDepth) + cellZ;
+		for (int i = RoomGridCellOffsets[cellID]; i < RoomGridCellOffsets[cellID + 1]; i++)
+		{
+			int roomNumber = RoomGridRoomNumbers[i];
+			if (IsPointInRoom(pos, roomNumber) && g_Level.Rooms[roomNumber].Active())
+				return roomNumber;
+		}
 	}
 
 	return (startRoomNumber != NO_VALUE) ? startRoomNumber : 0;
@@ -269,68 +363,125 @@ Vector3i GetRoomCenter(int roomNumber)
 		room.Position.z + halfDepth);
 }
 
-static std::vector<int> GetNeighborRoomNumbers(int roomNumber, unsigned int searchDepth, std::vector<int>& visitedRoomNumbers = std::vector<int>{})
+// Collects rooms reachable through up to searchDepth portals. Rooms without portals are their own neighbors.
+static void CollectNeighborRoomNumbers(int roomNumber, unsigned int searchDepth, std::vector<int>& neighborRoomNumbers,
+									   std::vector<int>& frontier, std::vector<int>& nextFrontier)
 {
-	// Invalid room; return empty vector.
-	if (g_Level.Rooms.size() <= roomNumber)
-		return {};
-
-	// Search depth limit reached; return empty vector.
-	if (searchDepth == 0)
-		return {};
-
-	// Collect current room number as neighbor of itself.
-	visitedRoomNumbers.push_back(roomNumber);
+	neighborRoomNumbers.clear();
+	frontier.assign(1, roomNumber);
 
-	auto neighborRoomNumbers = std::vector<int>{};
-
-	// Recursively collect neighbors of current neighbor.
-	const auto& room = g_Level.Rooms[roomNumber];
-	if (room.doors.empty())
+	for (unsigned int depth = 0; depth < searchDepth && !frontier.empty(); depth++)
 	{
-		neighborRoomNumbers.push_back(roomNumber);
-	}
-	else
-	{
-		for (int doorID = 0; doorID < room.doors.size(); doorID++)
+		nextFrontier.clear();
+		for (int frontierRoomNumber : frontier)
 		{
-			int neighborRoomNumber = room.doors[doorID].room;
-			neighborRoomNumbers.push_back(neighborRoomNumber);
+			// Invalid room; skip.
+			if (g_Level.Rooms.size() <= frontierRoomNumber)
+				continue;
+
+			const auto& room = g_Level.Rooms[frontierRoomNumber];
+			if (room.doors.empty())
+			{
+				nextFrontier.push_back(frontierRoomNumber);
+				continue;
+			}
 
-			auto recNeighborRoomNumbers = GetNeighborRoomNumbers(neighborRoomNumber, searchDepth - 1, visitedRoomNumbers);
-			neighborRoomNumbers.insert(neighborRoomNumbers.end(), recNeighborRoomNumbers.begin(), recNeighborRoomNumbers.end());
+			for (const auto& door : room.doors)
+				nextFrontier.push_back(door.room);
 		}
+
+		std::sort(nextFrontier.begin(), nextFrontier.end());
+		nextFrontier.erase(std::unique(nextFrontier.begin(), nextFrontier.end()), nextFrontier.end());
+
+		neighborRoomNumbers.insert(neighborRoomNumbers.end(), nextFrontier.begin(), nextFrontier.end());
+		std::swap(frontier, nextFrontier);
 	}
 
 	// Sort and clean collection.
 	std::sort(neighborRoomNumbers.begin(), neighborRoomNumbers.end());
 	neighborRoomNumbers.erase(std::unique(neighborRoomNumbers.begin(), neighborRoomNumbers.end()), neighborRoomNumbers.end());
-
-	return neighborRoomNumbers;
 }
 
-void InitializeNeighborRoomList()
+// Builds neighbor room table from current room state. Range of each room is [starts[roomNumber], starts[roomNumber + 1]).
+void BuildNeighborRoomTable(std::vector<int>& neighborRoomTable, std::vector<int>& starts)
 {
 	constexpr auto NEIGHBOR_ROOM_SEARCH_DEPTH = 2;
 
-	for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+	int roomCount = (int)g_Level.Rooms.size();
+
+	// Collect sorted neighbors of each room.
+	auto offsets = std::vector<int>(roomCount + 1, 0);
+	auto neighborRoomNumbers = std::vector<int>{};
+	auto frontier = std::vector<int>{};
+	auto nextFrontier = std::vector<int>{};
+
+	auto table = std::vector<int>{};
+	for (int roomNumber = 0; roomNumber < roomCount; roomNumber++)
 	{
-		auto& room = g_Level.Rooms[roomNumber];
-		room.NeighborRoomNumbers = GetNeighborRoomNumbers(roomNumber, NEIGHBOR_ROOM_SEARCH_DEPTH);
+		CollectNeighborRoomNumbers(roomNumber, NEIGHBOR_ROOM_SEARCH_DEPTH, neighborRoomNumbers, frontier, nextFrontier);
+		table.insert(table.end(), neighborRoomNumbers.begin(), neighborRoomNumbers.end());
+		offsets[roomNumber + 1] = (int)table.size();
 	}
 
-	// Add flipped variations of itself.
-	for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+	// Add flipped variations of itself after sorted neighbors, in room order.
+	auto flipNeighbors = std::vector<std::pair<int, int>>{};
+	auto hasNeighbor = [&](int roomNumber, int neighborRoomNumber)
 	{
-		auto& room = g_Level.Rooms[roomNumber];
+		auto begin = table.begin() + offsets[roomNumber];
+		auto end = table.begin() + offsets[roomNumber + 1];
+
+		return (std::find(begin, end, neighborRoomNumber) != end ||
+				Contains(flipNeighbors, std::pair<int, int>(roomNumber, neighborRoomNumber)));
+	};
+
+	for (int roomNumber = 0; roomNumber < roomCount; roomNumber++)
+	{
+		const auto& room = g_Level.Rooms[roomNumber];
 		if (room.flippedRoom == NO_VALUE)
 			continue;
 
-		if (!Contains(room.NeighborRoomNumbers, room.flippedRoom))
-			room.NeighborRoomNumbers.push_back(room.flippedRoom);
+		if (!hasNeighbor(roomNumber, room.flippedRoom))
+			flipNeighbors.push_back({ roomNumber, room.flippedRoom });
+
+		if (!hasNeighbor(room.flippedRoom, roomNumber))
+			flipNeighbors.push_back({ room.flippedRoom, roomNumber });
+	}
+
+	std::stable_sort(
+		flipNeighbors.begin(), flipNeighbors.end(),
+		[](const auto& flipNeighbor0, const auto& flipNeighbor1)
+		{
+			return (flipNeighbor0.first < flipNeighbor1.first);
+		});
+
+	// Build final table.
+	neighborRoomTable.clear();
+	neighborRoomTable.reserve(table.size() + flipNeighbors.size());
+
+	starts.assign(roomCount + 1, 0);
+	auto flipNeighborIt = flipNeighbors.begin();
+	for (int roomNumber = 0; roomNumber < roomCount; roomNumber++)
+	{
+		starts[roomNumber] = (int)neighborRoomTable.size();
+		neighborRoomTable.insert(neighborRoomTable.end(), table.begin() + offsets[roomNumber], table.begin() + offsets[roomNumber + 1]);
+
+		for (; flipNeighborIt != flipNeighbors.end() && flipNeighborIt->first == roomNumber; flipNeighborIt++)
+			neighborRoomTable.push_back(flipNeighborIt->second);
+	}
 
-		auto& flippedRoom = g_Level.Rooms[room.flippedRoom];
-		if (!Contains(flippedRoom.NeighborRoomNumbers, roomNumber))
-			flippedRoom.NeighborRoomNumbers.push_back(roomNumber);
+	starts[roomCount] = (int)neighborRoomTable.size();
+}
+
+void InitializeNeighborRoomList()
+{
+	auto starts = std::vector<int>{};
+	BuildNeighborRoomTable(NeighborRoomTable, starts);
+
+	// Point rooms at their ranges.
+	for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+	{
+		auto& span = g_Level.Rooms[roomNumber].NeighborRoomNumbers;
+		span.Data = NeighborRoomTable.data() + starts[roomNumber];
+		span.Count = starts[roomNumber + 1] - starts[roomNumber];
 	}
 }
@@ -85,6 +85,18 @@ struct MESH_INFO
 	bool Dirty;
 };
 
+// Range of neighbor room numbers in level-wide neighbor room table.
+struct RoomNumberSpan
+{
+	const int* Data	 = nullptr;
+	int		   Count = 0;
+
+	const int* begin() const { return Data; }
+	const int* end() const { return (Data + Count); }
+	int size() const { return Count; }
+	bool Contains(int roomNumber) const { return (std::find(begin(), end(), roomNumber) != end()); }
+};
+
 struct ROOM_INFO
 {
 	int						 RoomNumber = 0;
@@ -107,7 +119,7 @@ struct ROOM_INFO
 	short fxNumber;
 	bool boundActive;
 
-	std::vector<int> NeighborRoomNumbers = {};
+	RoomNumberSpan NeighborRoomNumbers = {};
 
 	std::vector<FloorInfo>	   Sectors		  = {};
 	std::vector<ROOM_LIGHT>	   lights		  = {};
@@ -130,7 +142,9 @@ bool IsPointInRoom(const Vector3i& pos, int roomNumber);
 int FindRoomNumber(const Vector3i& pos, int startRoomNumber = NO_VALUE);
 Vector3i GetRoomCenter(int roomNumber);
 int IsRoomOutside(int x, int y, int z);
+void BuildNeighborRoomTable(std::vector<int>& neighborRoomTable, std::vector<int>& starts);
 void InitializeNeighborRoomList();
+void InitializeRoomGrid();
 
 GameBoundingBox& GetBoundsAccurate(const MESH_INFO& mesh, bool getVisibilityBox);
 
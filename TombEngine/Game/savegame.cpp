@@ -19,6 +19,7 @@
 #include "Game/spotcam.h"
 #include "Game/room.h"
 #include "Game/Setup.h"
+#include "Objects/Generic/Object/Pushable/PushableStack.h"
 #include "Objects/Generic/Object/rope.h"
 #include "Objects/Generic/Switches/fullblock_switch.h"
 #include "Objects/Generic/puzzles_keys.h"
@@ -2083,6 +2084,8 @@ static void ParseEffects(const Save::SaveGame* s)
 		particle->nodeNumber = particleInfo->node_number();
 	}
 
+	RebuildParticlePool();
+
 	for (int i = 0; i < s->bats()->size(); i++)
 	{
 		auto* batInfo = s->bats()->Get(i);
@@ -2548,6 +2551,9 @@ static void ParseLevel(const Save::SaveGame* s, bool hubMode)
 			item->Data = savedData->scalar();
 		}
 	}
+
+	RebuildItemObjectIndex();
+	RebuildPushableStackIndex();
 }
 
 void SaveGame::Parse(const std::vector<byte>& buffer, bool hubMode)
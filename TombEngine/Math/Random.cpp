@@ -9,6 +9,16 @@
 namespace TEN::Math::Random
 {
 	static std::mt19937 Engine;
+	static std::mt19937 DrawEngine;
+
+	void SetSeed(unsigned int seed)
+	{
+		Engine.seed(seed);
+		DrawEngine.seed(seed);
+
+		// Also seed CRT generator of calling thread, which is used by Lua math.random.
+		std::srand(seed);
+	}
 
 	int GenerateInt(int low, int high)
 	{
@@ -25,6 +35,11 @@ namespace TEN::Math::Random
 		return (short)GenerateInt(low, high);
 	}
 
+	int GenerateDrawInt(int low, int high)
+	{
+		return (DrawEngine() / (DrawEngine.max() / (high - low + 1) + 1) + low);
+	}
+
 	Vector2 GenerateDirection2D()
 	{
 		float angle = GenerateFloat(0.0f, PI_MUL_2); // Generate angle in full circle.
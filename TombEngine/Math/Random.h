@@ -4,12 +4,19 @@ class EulerAngles;
 
 namespace TEN::Math::Random
 {
+	// Seeding
+
+	void SetSeed(unsigned int seed);
+
 	// Value generation
 
 	int	  GenerateInt(int low = 0, int high = SHRT_MAX);
 	float GenerateFloat(float low = 0.0f, float high = 1.0f);
 	short GenerateAngle(short low = SHRT_MIN, short high = SHRT_MAX);
 
+	// Draw-only values. Uses separate sequence, so that rendering doesn't affect gameplay randomness.
+	int GenerateDrawInt(int low = 0, int high = SHRT_MAX);
+
 	// 2D geometric generation
 
 	Vector2 GenerateDirection2D();
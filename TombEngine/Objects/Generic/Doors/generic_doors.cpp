@@ -21,8 +21,10 @@
 #include "Game/itemdata/door_data.h"
 #include "Game/collision/collide_room.h"
 #include "Game/collision/collide_item.h"
+#include "Game/collision/Point.h"
 #include "Game/itemdata/itemdata.h"
 
+using namespace TEN::Collision::Point;
 using namespace TEN::Collision::Room;
 using namespace TEN::Collision::Sphere;
 using namespace TEN::Gui;
@@ -398,6 +400,7 @@ namespace TEN::Entities::Doors
 		if (floor != NULL)
 		{
 			*doorPos->floor = doorPos->data;
+			InvalidatePointCollisionCache();
 
 			short boxIndex = doorPos->block;
 			if (boxIndex != NO_VALUE)
@@ -432,6 +435,7 @@ namespace TEN::Entities::Doors
 			floor->FloorSurface.Triangles[1].Plane =
 			floor->CeilingSurface.Triangles[0].Plane =
 			floor->CeilingSurface.Triangles[1].Plane = WALL_PLANE;
+			InvalidatePointCollisionCache();
 
 			short boxIndex = doorPos->block;
 			if (boxIndex != NO_VALUE)
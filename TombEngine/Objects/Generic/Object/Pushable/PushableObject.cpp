@@ -113,6 +113,9 @@ namespace TEN::Entities::Generic
 			ItemNewRoom(itemNumber, probeRoomNumber);
 			pushable.StartPos.RoomNumber = pushableItem.RoomNumber;
 		}
+
+		// Update stack index. Cheap if pushable stayed in same sector column.
+		UpdatePushableStackIndex(itemNumber);
 	}
 
 	// If player is holding Action, initiates object interaction.
@@ -3,6 +3,8 @@
 
 #include "Game/collision/floordata.h"
 #include "Game/collision/Point.h"
+#include "Game/control/control.h"
+#include "Game/items.h"
 #include "Game/Setup.h"
 #include "Objects/Generic/Object/Pushable/PushableBridge.h"
 #include "Objects/Generic/Object/Pushable/PushableObject.h"
@@ -25,10 +27,128 @@ namespace TEN::Entities::Generic
 		}
 	};
 
+	// Pushables are indexed by world sector column, so that stack queries only visit pushables in that column
+	// instead of walking room item lists. Pushable is reindexed at end of its control and when moved by scripts.
+	static auto PushableSectorMap  = std::unordered_map<int, std::vector<int>>{}; // Sector key - pushable item numbers.
+	static auto PushableSectorKeys = std::unordered_map<int, int>{};			   // Pushable item number - sector key.
+
+	static bool IsClimbablePushable(const ItemInfo& item)
+	{
+		return (item.ObjectNumber >= ID_PUSHABLE_OBJECT_CLIMBABLE1 && item.ObjectNumber <= ID_PUSHABLE_OBJECT_CLIMBABLE10);
+	}
+
+	static int GetPushableSectorKey(const Vector3i& pos)
+	{
+		int sectorX = (int)floor(pos.x / (float)BLOCK(1));
+		int sectorZ = (int)floor(pos.z / (float)BLOCK(1));
+		return ((sectorX << 16) | (sectorZ & 0xFFFF));
+	}
+
+	static void RemovePushableFromIndex(int itemNumber)
+	{
+		auto keyIt = PushableSectorKeys.find(itemNumber);
+		if (keyIt == PushableSectorKeys.end())
+			return;
+
+		auto mapIt = PushableSectorMap.find(keyIt->second);
+		if (mapIt != PushableSectorMap.end())
+		{
+			auto& itemNumbers = mapIt->second;
+			itemNumbers.erase(std::remove(itemNumbers.begin(), itemNumbers.end(), itemNumber), itemNumbers.end());
+
+			if (itemNumbers.empty())
+				PushableSectorMap.erase(mapIt);
+		}
+
+		PushableSectorKeys.erase(keyIt);
+	}
+
+	void UpdatePushableStackIndex(int itemNumber)
+	{
+		const auto& pushableItem = g_Level.Items[itemNumber];
+		int key = GetPushableSectorKey(pushableItem.Pose.Position);
+
+		auto keyIt = PushableSectorKeys.find(itemNumber);
+		if (keyIt != PushableSectorKeys.end())
+		{
+			if (keyIt->second == key)
+				return;
+
+			RemovePushableFromIndex(itemNumber);
+		}
+
+		PushableSectorKeys[itemNumber] = key;
+		PushableSectorMap[key].push_back(itemNumber);
+	}
+
+	static int FindPushableBelowByScan(const ItemInfo& pushableItem)
+	{
+		int belowItemNumber = NO_VALUE;
+		for (int currentItemNumber : FindAllPushables())
+		{
+			if (currentItemNumber == pushableItem.Index)
+				continue;
+
+			const auto& currentItem = g_Level.Items[currentItemNumber];
+			if (!currentItem.Data.is<PushableInfo>() ||
+				!IsClimbablePushable(currentItem) ||
+				currentItem.Pose.Position.x != pushableItem.Pose.Position.x ||
+				currentItem.Pose.Position.z != pushableItem.Pose.Position.z ||
+				currentItem.Pose.Position.y <= pushableItem.Pose.Position.y)
+			{
+				continue;
+			}
+
+			if (belowItemNumber == NO_VALUE || currentItem.Pose.Position.y < g_Level.Items[belowItemNumber].Pose.Position.y)
+				belowItemNumber = currentItemNumber;
+		}
+
+		return belowItemNumber;
+	}
+
+	// Compares index against full scan of all pushables. Returns number of pushables for which they differ.
+	int ValidatePushableStackIndex()
+	{
+		int mismatchCount = 0;
+		for (int itemNumber : FindAllPushables())
+		{
+			const auto& pushableItem = g_Level.Items[itemNumber];
+			if (!pushableItem.Data.is<PushableInfo>())
+				continue;
+
+			auto keyIt = PushableSectorKeys.find(itemNumber);
+			if (keyIt == PushableSectorKeys.end() || keyIt->second != GetPushableSectorKey(pushableItem.Pose.Position) ||
+				FindPushableBelow(pushableItem) != FindPushableBelowByScan(pushableItem))
+			{
+				mismatchCount++;
+			}
+		}
+
+		return mismatchCount;
+	}
+
+	void RebuildPushableStackIndex()
+	{
+		PushableSectorMap.clear();
+		PushableSectorKeys.clear();
+
+		for (int itemNumber : FindAllPushables())
+		{
+			if (g_Level.Items[itemNumber].Data.is<PushableInfo>())
+				UpdatePushableStackIndex(itemNumber);
+		}
+	}
+
 	void InitializePushableStacks()
 	{
+		PushableSectorMap.clear();
+		PushableSectorKeys.clear();
+
+		// Headless runs compare index against full scan after every frame.
+		RegisterHeadlessCheck("PushableStackIndex", []() { return (ValidatePushableStackIndex() == 0); });
+
 		// 1) Collect all pushables in level.
-		auto& pushableItemNumbers = FindAllPushables(g_Level.Items);
+		auto pushableItemNumbers = FindAllPushables();
 		if (pushableItemNumbers.empty())
 			return;
 
@@ -50,6 +170,7 @@ namespace TEN::Entities::Generic
 			int y = pointColl.GetFloorHeight();
 			
 			stackGroups.emplace(Vector3i(x, y, z), std::vector<int>()).first->second.push_back(itemNumber);
+			UpdatePushableStackIndex(itemNumber);
 		}
 
 		// 4) Iterate through stack groups lists, sort each by vertical position, and iterate to make stack links.
@@ -88,20 +209,24 @@ namespace TEN::Entities::Generic
 		}
 	}
 
-	std::vector<int> FindAllPushables(const std::vector<ItemInfo>& items)
+	std::vector<int> FindAllPushables()
 	{
 		auto pushableItemNumbers = std::vector<int>{};
-		for (int i = 0; i < items.size(); i++)
-		{
-			auto& item = items[i];
 
-			if ((item.ObjectNumber >= ID_PUSHABLE_OBJECT1 && item.ObjectNumber <= ID_PUSHABLE_OBJECT10) ||
-				(item.ObjectNumber >= ID_PUSHABLE_OBJECT_CLIMBABLE1 && item.ObjectNumber <= ID_PUSHABLE_OBJECT_CLIMBABLE10))
+		auto collectItemNumbers = [&](GAME_OBJECT_ID firstObjectID, GAME_OBJECT_ID lastObjectID)
+		{
+			for (int objectID = firstObjectID; objectID <= lastObjectID; objectID++)
 			{
-				pushableItemNumbers.push_back(i);
+				const auto& itemNumbers = GetItemNumbersByObjectID((GAME_OBJECT_ID)objectID);
+				pushableItemNumbers.insert(pushableItemNumbers.end(), itemNumbers.begin(), itemNumbers.end());
 			}
-		}
+		};
 
+		collectItemNumbers(ID_PUSHABLE_OBJECT1, ID_PUSHABLE_OBJECT10);
+		collectItemNumbers(ID_PUSHABLE_OBJECT_CLIMBABLE1, ID_PUSHABLE_OBJECT_CLIMBABLE10);
+
+		// Keep level order, so that stack groups are built same way as before.
+		std::sort(pushableItemNumbers.begin(), pushableItemNumbers.end());
 		return pushableItemNumbers;
 	}
 
@@ -138,87 +263,54 @@ namespace TEN::Entities::Generic
 
 	int SearchNearPushablesStack(int itemNumber)
 	{
-		auto& pushableItem = g_Level.Items[itemNumber];
-
-		int pushabelStackFound = FindPushableStackInRoom(itemNumber, pushableItem.RoomNumber);
-
-		if (pushabelStackFound != NO_VALUE)
-			return pushabelStackFound;
-
-		// Otherwise, check room below.
-		//auto collisionResult = GetPointCollision(pushableItem.Pose.Position.x, pushableItem.Pose.Position.y, pushableItem.Pose.Position.z, pushableItem.RoomNumber);		
-		//auto roomNumberBelow = collisionResult.Block->GetRoomNumberBelow(pushableItem.Pose.Position.x, pushableItem.Pose.Position.y, pushableItem.Pose.Position.z).value();
-		//pushabelStackFound = FindPushableStackInRoom(itemNumber, roomNumberBelow);
+		// Pushable has settled; reindex it before searching, as other pushables may later search its column.
+		UpdatePushableStackIndex(itemNumber);
 
-		return NO_VALUE;
+		const auto& pushableItem = g_Level.Items[itemNumber];
+		return FindPushableBelow(pushableItem);
 	}
 
-	int FindPushableStackInRoom(int itemNumber, int roomNumber)
+	int FindPushableBelow(const ItemInfo& pushableItem)
 	{
-		auto& pushableItem = g_Level.Items[itemNumber];
-		auto& pushable = GetPushableInfo(pushableItem);
+		auto mapIt = PushableSectorMap.find(GetPushableSectorKey(pushableItem.Pose.Position));
+		if (mapIt == PushableSectorMap.end())
+			return NO_VALUE;
 
-		if (roomNumber != NO_VALUE)
+		// Find nearest climbable pushable at same XZ position and at lower height. Column may span several rooms.
+		int belowItemNumber = NO_VALUE;
+		for (int currentItemNumber : mapIt->second)
 		{
-			short currentItemNumber = g_Level.Rooms[roomNumber].itemNumber;
-			while (currentItemNumber != NO_VALUE)
-			{
-				auto& currentItem = g_Level.Items[currentItemNumber];
+			if (currentItemNumber == pushableItem.Index)
+				continue;
 
-				// If climbable pushable, is in the same XZ position and is at a lower height.
-				if ((currentItem.ObjectNumber >= ID_PUSHABLE_OBJECT_CLIMBABLE1 && currentItem.ObjectNumber <= ID_PUSHABLE_OBJECT_CLIMBABLE10) &&
-					(currentItem.Pose.Position.x == pushableItem.Pose.Position.x) && (currentItem.Pose.Position.z == pushableItem.Pose.Position.z) &&
-					(currentItem.Pose.Position.y > pushableItem.Pose.Position.y))
-				{
-					// Find top item.
-					if (pushable.Stack.ItemNumberAbove == NO_VALUE)
-					{
-						return currentItemNumber;
-					}
-					else
-					{
-						int topItemNumber = pushable.Stack.ItemNumberAbove;
-						while (topItemNumber != NO_VALUE)
-						{
-							auto& topItem = g_Level.Items[topItemNumber];
-							auto& topPushable = GetPushableInfo(topItem);
-
-							if (topPushable.Stack.ItemNumberAbove == NO_VALUE)
-							{
-								return topItemNumber;
-							}
-							else
-							{
-								topItemNumber = topPushable.Stack.ItemNumberAbove;
-							}
-						}
-					}
-				}
-				else
-				{
-					currentItemNumber = currentItem.NextItem;
-				}
+			const auto& currentItem = g_Level.Items[currentItemNumber];
+			if (!IsClimbablePushable(currentItem) ||
+				currentItem.Pose.Position.x != pushableItem.Pose.Position.x ||
+				currentItem.Pose.Position.z != pushableItem.Pose.Position.z ||
+				currentItem.Pose.Position.y <= pushableItem.Pose.Position.y)
+			{
+				continue;
 			}
+
+			if (belowItemNumber == NO_VALUE || currentItem.Pose.Position.y < g_Level.Items[belowItemNumber].Pose.Position.y)
+				belowItemNumber = currentItemNumber;
 		}
 
-		return NO_VALUE;
+		return belowItemNumber;
 	}
 
 	int GetPushableCountInStack(int itemNumber)
 	{
-		auto pushableItemCopy = g_Level.Items[itemNumber];
-		auto& pushableCopy = GetPushableInfo(pushableItemCopy);
+		const auto* pushable = &GetPushableInfo(g_Level.Items[itemNumber]);
 
 		int count = 1;
-		while (pushableCopy.Stack.ItemNumberAbove != NO_VALUE)
+		while (pushable->Stack.ItemNumberAbove != NO_VALUE)
 		{
 			// Filter out current pushable item.
-			if (pushableCopy.Stack.ItemNumberAbove == itemNumber)
+			if (pushable->Stack.ItemNumberAbove == itemNumber)
 				break;
 
-			pushableItemCopy = g_Level.Items[pushableCopy.Stack.ItemNumberAbove];
-			pushableCopy = GetPushableInfo(pushableItemCopy);
-
+			pushable = &GetPushableInfo(g_Level.Items[pushable->Stack.ItemNumberAbove]);
 			count++;
 		}
 
@@ -236,17 +328,17 @@ namespace TEN::Entities::Generic
 
 	int GetStackHeight(int itemNumber)
 	{
-		auto pushableItemCopy = g_Level.Items[itemNumber];
-		auto& pushableCopy = GetPushableInfo(pushableItemCopy);
-
-		int totalHeight = pushableCopy.Height;
+		const auto* pushable = &GetPushableInfo(g_Level.Items[itemNumber]);
 
-		while (pushableCopy.Stack.ItemNumberAbove != NO_VALUE)
+		int totalHeight = pushable->Height;
+		while (pushable->Stack.ItemNumberAbove != NO_VALUE)
 		{
-			pushableItemCopy = g_Level.Items[pushableCopy.Stack.ItemNumberAbove];
-			pushableCopy = GetPushableInfo(pushableItemCopy);
+			// Filter out current pushable item.
+			if (pushable->Stack.ItemNumberAbove == itemNumber)
+				break;
 
-			totalHeight = totalHeight + pushableCopy.Height;
+			pushable = &GetPushableInfo(g_Level.Items[pushable->Stack.ItemNumberAbove]);
+			totalHeight += pushable->Height;
 		}
 
 		return totalHeight;
@@ -285,6 +377,7 @@ namespace TEN::Entities::Generic
 			auto& currentPushable = GetPushableInfo(currentPushableItem);
 
 			currentPushableItem.Pose.Position = GetNearestSectorCenter(currentPushableItem.Pose.Position);
+			UpdatePushableStackIndex(currentItemNumber);
 
 			// Activate collision.
 			if (currentPushable.UseRoomCollision)
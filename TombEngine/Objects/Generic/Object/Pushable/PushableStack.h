@@ -5,13 +5,16 @@ struct ItemInfo;
 namespace TEN::Entities::Generic
 {
 	void InitializePushableStacks();
-	std::vector<int> FindAllPushables(const std::vector<ItemInfo>& items);
+	void UpdatePushableStackIndex(int itemNumber);
+	void RebuildPushableStackIndex();
+	int  ValidatePushableStackIndex();
+	std::vector<int> FindAllPushables();
 
 	void StackPushable(int itemNumber, int targetItemNumber);
 	void UnstackPushable(int itemNumber);
 	
 	int SearchNearPushablesStack(int itemNumber);
-	int FindPushableStackInRoom(int itemNumber, int roomNumber);
+	int FindPushableBelow(const ItemInfo& pushableItem);
 
 	int GetPushableCountInStack(int itemNumber);
 	bool IsWithinStackLimit(int itemNumber);
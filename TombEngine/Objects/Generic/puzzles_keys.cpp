@@ -80,6 +80,7 @@ void PuzzleHoleCollision(short itemNumber, ItemInfo* laraItem, CollisionInfo* co
 	if (receptacleItem.ItemFlags[5] == (int)ReusableReceptacleState::Done)
 	{
 		receptacleItem.ObjectNumber += GAME_OBJECT_ID{ ID_PUZZLE_DONE1 - ID_PUZZLE_HOLE1 };
+		UpdateItemObjectIndex(itemNumber);
 		SetAnimation(receptacleItem, 0);
 		receptacleItem.ResetModelToDefault();
 		return;
@@ -244,6 +245,7 @@ void PuzzleDoneCollision(short itemNumber, ItemInfo* laraItem, CollisionInfo* co
 	if (receptacleItem.ItemFlags[5] == (int)ReusableReceptacleState::Empty)
 	{
 		receptacleItem.ObjectNumber = GAME_OBJECT_ID(receptacleItem.ObjectNumber - (ID_PUZZLE_DONE1 - ID_PUZZLE_HOLE1));
+		UpdateItemObjectIndex(itemNumber);
 		SetAnimation(receptacleItem, 0);
 		receptacleItem.ResetModelToDefault();
 		return;
@@ -337,6 +339,7 @@ void PuzzleDone(ItemInfo* item, short itemNumber)
 		item->ItemFlags[1] = true;
 
 		item->ObjectNumber += GAME_OBJECT_ID{ ID_PUZZLE_DONE1 - ID_PUZZLE_HOLE1 };
+		UpdateItemObjectIndex(itemNumber);
 		item->ItemFlags[5] = (int)ReusableReceptacleState::Done;
 		SetAnimation(item, 0);
 		item->ResetModelToDefault();	
@@ -344,6 +347,7 @@ void PuzzleDone(ItemInfo* item, short itemNumber)
 	else
 	{
 		item->ObjectNumber += GAME_OBJECT_ID{ ID_PUZZLE_DONE1 - ID_PUZZLE_HOLE1 };
+		UpdateItemObjectIndex(itemNumber);
 		item->Animation.AnimNumber = Objects[item->ObjectNumber].animIndex;
 		item->Animation.FrameNumber = GetAnimData(item).frameBase;
 		item->Animation.ActiveState = GetAnimData(item).ActiveState;
@@ -367,6 +371,7 @@ void PuzzleHole(ItemInfo* item, short itemNumber)
 	item->ItemFlags[1] = true;
 
 	item->ObjectNumber = GAME_OBJECT_ID(item->ObjectNumber - (ID_PUZZLE_DONE1 - ID_PUZZLE_HOLE1));
+	UpdateItemObjectIndex(itemNumber);
 	item->ItemFlags[5] = (int)ReusableReceptacleState::Empty;
 	SetAnimation(item, 0);
 	item->ResetModelToDefault();
@@ -325,6 +325,7 @@ namespace TEN::Entities::Creatures::TR2
 			DisableEntityAI(skidooItemNumber);
 			skidooItem->ObjectNumber = ID_SNOWMOBILE;
 			skidooItem->Status = ITEM_DEACTIVATED;
+			UpdateItemObjectIndex(skidooItemNumber);
 
 			InitializeSkidoo(skidooItemNumber);
 			if (skidooItem->Data.is<SkidooInfo>())
@@ -307,6 +307,7 @@ namespace TEN::Entities::TR4
 					{
 						creature->Enemy = nullptr;
 						target->ObjectNumber = aiObject->objectNumber;
+						UpdateItemObjectIndex(target->Index);
 						target->RoomNumber = aiObject->roomNumber;
 						target->Pose.Position = aiObject->pos.Position;
 						target->Pose.Orientation.y = aiObject->pos.Orientation.y;
@@ -19,7 +19,9 @@
 #include "Specific/fast_vector.h"
 #include "Renderer/RendererEnums.h"
 #include "Renderer/Structures/RendererLight.h"
+#include "Renderer/Structures/RendererLightGrid.h"
 #include "Renderer/RenderView.h"
+#include "Renderer/RendererUtils.h"
 #include "Renderer/ConstantBuffers/StaticBuffer.h"
 #include "Renderer/ConstantBuffers/LightBuffer.h"
 #include "Renderer/ConstantBuffers/HUDBarBuffer.h"
@@ -198,6 +200,7 @@ namespace TEN::Renderer
 		// Text
 		std::unique_ptr<SpriteFont> _gameFont;
 		std::vector<RendererStringToDraw> _stringsToDraw;
+		std::unordered_map<std::string, RendererStringLayout> _stringLayoutCache;
 		float _blinkColorValue = 0.0f;
 		float _blinkTime		  = 0.0f;
 		bool  _isBlinkUpdated  = false;
@@ -231,11 +234,20 @@ namespace TEN::Renderer
 		// Rooms and collector
 		std::vector<RendererRoom> _rooms;
 		bool _invalidateCache;
-		std::vector<short> _visitedRoomsStack;
+		std::vector<RendererRoomNode> _roomNodes;
+		std::vector<int> _roomNodeStack;
+		std::vector<std::vector<bool>> _potentiallyVisibleRooms; // Built lazily per camera room, cleared on room flip.
+
+		// Scene preparation jobs
+		std::vector<RendererItem*> _itemsToPrepare;
+		std::vector<RendererEffect*> _effectsToPrepare;
+		std::vector<std::pair<int, int>> _itemAnimationJobs; // Ranges in _itemsToPrepare sharing same object.
 
 		// Lights
 		std::vector<RendererLight> _dynamicLights;
 		RendererLight* _shadowLight;
+		RendererLightGrid _lightGrid;
+		bool _useLightGrid = true;
 
 		// Lines
 		std::vector<RendererLine2D>		_lines2DToDraw	   = {};
@@ -288,6 +300,8 @@ namespace TEN::Renderer
 		int _numDotProducts = 0;
 		int _numCheckPortalCalls = 0;
 		int _numGetVisibleRoomsCalls = 0;
+		int _numPvsCulledPortals = 0;
+		int _numMemoizedPortals = 0;
 
 		float _currentLineHeight = 0.0f;;
 
@@ -298,6 +312,9 @@ namespace TEN::Renderer
 		int _timeRoomsCollector;
 		int _timeDraw;
 		int _timeFrame;
+		int _timeSort; // Microseconds.
+		int _timeStrings = 0; // Microseconds, previous frame.
+		int _timeStringsAccumulator = 0;
 		float _fps;
 		int _currentCausticsFrame;
 
@@ -318,6 +335,12 @@ namespace TEN::Renderer
 
 		std::vector<RendererSpriteBucket> _spriteBuckets;
 
+		// Persistent sort buffers
+		std::vector<Utils::SortKey> _sortKeys;
+		std::vector<Utils::SortKey> _sortKeysBuffer;
+		std::vector<RendererSpriteToDraw> _sortedSpritesToDraw;
+		std::vector<RendererSortableObject> _sortedTransparentObjects;
+
 		ComPtr<ID3D11SamplerState> _shadowSampler;
 
 		// Antialiasing
@@ -390,10 +413,15 @@ namespace TEN::Renderer
 		void UpdateAnimation(RendererItem* item, RendererObject& obj, const AnimFrameInterpData& frameData, int mask, bool useObjectWorldRotation = false);
 		bool CheckPortal(short parentRoomNumber, RendererDoor* door, Vector4 viewPort, Vector4* clipPort, RenderView& renderView);
 		void GetVisibleRooms(short from, short to, Vector4 viewPort, bool water, int count, bool onlyRooms, RenderView& renderView);
+		const std::vector<bool>& GetPotentiallyVisibleRooms(short roomNumber);
+		std::vector<bool> ComputePotentiallyVisibleRooms(short roomNumber);
 		void CollectRooms(RenderView& renderView, bool onlyRooms);
+		void CollectLightsForItemsAndEffects(RenderView& renderView);
 		void CollectItems(short roomNumber, RenderView& renderView);
 		void CollectStatics(short roomNumber, RenderView& renderView);
 		void CollectLights(Vector3 position, float radius, int roomNumber, int prevRoomNumber, bool prioritizeShadowLight, bool useCachedRoomLights, std::vector<RendererLightNode>* roomsLights, std::vector<RendererLight*>* outputLights);
+		void BuildRoomLightGrid();
+		int  GetLightGridCellIndex(int x, int z) const;
 		void CollectLightsForItem(RendererItem* item);
 		void CollectLightsForEffect(short roomNumber, RendererEffect* effect);
 		void CollectLightsForRoom(short roomNumber, RenderView& renderView);
@@ -411,6 +439,7 @@ namespace TEN::Renderer
 		void InitializeMenuBars(int y);
 		void InitializeSky();
 		void DrawAllStrings();
+		const RendererStringLayout& GetStringLayout(const std::string& string);
 		void PrepareLaserBarriers(RenderView& view);
 		void PrepareSingleLaserBeam(RenderView& view);
 		void DrawHorizonAndSky(RenderView& renderView, ID3D11DepthStencilView* depthTarget);
@@ -583,6 +612,7 @@ namespace TEN::Renderer
 		void Create();
 		void Initialize(int w, int h, bool windowed, HWND handle);
 		void Render();
+		void RenderNull();
 		void RenderTitle();
 		void Lock();
 		bool PrepareDataForTheRenderer();
@@ -590,6 +620,9 @@ namespace TEN::Renderer
 		void RenderSimpleSceneToParaboloid(RenderTarget2D* renderTarget, Vector3 position, int emisphere);
 		void DumpGameScene();
 		void RenderInventory();
+		void PrepareScene(RenderView& view);
+		void UpdateLightGrid();
+		int  CollectLightsAtPosition(const Vector3& pos, int roomNumber, bool useLightGrid);
 		void RenderScene(RenderTarget2D* renderTarget, bool doAntialiasing, RenderView& view);
 		void ClearScene();
 		void SaveScreenshot();
@@ -629,7 +662,9 @@ namespace TEN::Renderer
 		void FlipRooms(short roomNumber1, short roomNumber2);
 		void UpdateLaraAnimations(bool force);
 		void UpdateItemAnimations(int itemNumber, bool force);
+		unsigned int GetItemAnimationRevision(int itemNumber);
 		std::vector<BoundingSphere> GetSpheres(int itemNumber);
+		void GetSpheres(int itemNumber, std::vector<BoundingSphere>& spheres);
 		void GetBoneMatrix(short itemNumber, int jointIndex, Matrix* outMatrix);
 		void DrawObjectIn2DSpace(int objectNumber, Vector2 pos2D, EulerAngles orient, float scale1, float opacity = 1.0f, int meshBits = NO_JOINT_BITS);
 		void SetLoadingScreen(std::wstring& fileName);
@@ -30,6 +30,8 @@ namespace TEN::Renderer
 		_spriteSequences.resize(ID_NUMBER_OBJECTS);
 		_staticObjects.resize(MAX_STATICS);
 		_rooms.resize(g_Level.Rooms.size());
+		_potentiallyVisibleRooms.clear();
+		_lightGrid.IsRoomLightsBuilt = false;
 
 		_meshes.clear();
 
@@ -9,6 +9,7 @@ namespace TEN::Renderer
 		_timeDraw = 0;
 		_timeFrame = 0;
 		_timeRoomsCollector = 0;
+		_timeSort = 0;
 		_numDrawCalls = 0;
 
 		_numRoomsDrawCalls = 0;
@@ -34,6 +35,8 @@ namespace TEN::Renderer
 		_numDotProducts = 0;
 		_numCheckPortalCalls = 0;
 		_numGetVisibleRoomsCalls = 0;
+		_numPvsCulledPortals = 0;
+		_numMemoizedPortals = 0;
 
 		_currentLineHeight;
 	}
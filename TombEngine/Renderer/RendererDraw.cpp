@@ -37,6 +37,7 @@ using namespace TEN::Effects::Hair;
 using namespace TEN::Entities::Creatures::TR3;
 using namespace TEN::Entities::Generic;
 using namespace TEN::Hud;
+using namespace TEN::Math;
 using namespace TEN::Renderer::Structures;
 
 extern GUNSHELL_STRUCT Gunshells[MAX_GUNSHELL];
@@ -495,7 +496,7 @@ namespace TEN::Renderer
 
 				if (rat->On)
 				{
-					RendererMesh* mesh = GetMesh(Objects[ID_RATS_EMITTER].meshIndex + (rand() % 8));
+					RendererMesh* mesh = GetMesh(Objects[ID_RATS_EMITTER].meshIndex + Random::GenerateDrawInt(0, 7));
 
 					for (int j = 0; j < mesh->Buckets.size(); j++)
 					{
@@ -569,7 +570,7 @@ namespace TEN::Renderer
 
 					if (rat->On)
 					{
-						RendererMesh* mesh = GetMesh(Objects[ID_RATS_EMITTER].meshIndex + (rand() % 8));
+						RendererMesh* mesh = GetMesh(Objects[ID_RATS_EMITTER].meshIndex + Random::GenerateDrawInt(0, 7));
 
 						_stStatic.World = rat->Transform;
 						_stStatic.Color = Vector4::One;
@@ -1628,32 +1629,21 @@ namespace TEN::Renderer
 		CalculateFrameRate();
 	}
 
-	void Renderer::RenderScene(RenderTarget2D* renderTarget, bool doAntialiasing, RenderView& view)
+	// CPU-side scene preparation. Does not submit anything to GPU.
+	void Renderer::PrepareScene(RenderView& view)
 	{
 		using ns = std::chrono::nanoseconds;
-		using get_time = std::chrono::steady_clock;
 
-		ResetDebugVariables();
-		_isLocked = false;
-		_doingFullscreenPass = false;
-
-		auto& level = *g_GameFlow->GetLevel(CurrentLevel);
-
-		// Prepare scene to draw.
 		auto time1 = std::chrono::high_resolution_clock::now();
+		UpdateLightGrid();
 		CollectRooms(view, false);
-		auto time = std::chrono::high_resolution_clock::now();
-		_timeRoomsCollector = (std::chrono::duration_cast<ns>(time - time1)).count() / 1000000;
-		time1 = time;
+		auto time2 = std::chrono::high_resolution_clock::now();
+		_timeRoomsCollector = (std::chrono::duration_cast<ns>(time2 - time1)).count() / 1000000;
 
 		UpdateLaraAnimations(false);
 		UpdateItemAnimations(view);
 
-		_stBlending.AlphaTest = -1;
-		_stBlending.AlphaThreshold = -1;
-
 		CollectLightsForCamera();
-		RenderItemShadows(view);
 
 		// Prepare all sprites for later.
 		PrepareFires(view);
@@ -1681,6 +1671,27 @@ namespace TEN::Renderer
 
 		// Sprites grouped in buckets for instancing. Non-commutative sprites are collected for a later stage.
 		SortAndPrepareSprites(view);
+	}
+
+	void Renderer::RenderScene(RenderTarget2D* renderTarget, bool doAntialiasing, RenderView& view)
+	{
+		using ns = std::chrono::nanoseconds;
+		using get_time = std::chrono::steady_clock;
+
+		ResetDebugVariables();
+		_isLocked = false;
+		_doingFullscreenPass = false;
+
+		auto& level = *g_GameFlow->GetLevel(CurrentLevel);
+
+		// Prepare scene to draw.
+		auto time1 = std::chrono::high_resolution_clock::now();
+		PrepareScene(view);
+
+		_stBlending.AlphaTest = -1;
+		_stBlending.AlphaThreshold = -1;
+
+		RenderItemShadows(view);
 
 		auto time2 = std::chrono::high_resolution_clock::now();
 		_timeUpdate = (std::chrono::duration_cast<ns>(time2 - time1)).count() / 1000000;
@@ -2853,6 +2864,17 @@ namespace TEN::Renderer
 		_swapChain->Present(1, 0);
 	}
 
+	// Used in headless mode instead of Render(). Runs CPU-side scene preparation, which also updates
+	// state game logic reads back (e.g. player bone matrices), and clears per-frame scene data without any GPU submission.
+	void Renderer::RenderNull()
+	{
+		ResetDebugVariables();
+		_isLocked = false;
+
+		PrepareScene(_gameCamera);
+		ClearScene();
+	}
+
 	void Renderer::DrawMoveableMesh(RendererItem* itemToDraw, RendererMesh* mesh, RendererRoom* room, int boneIndex, RenderView& view, RendererPass rendererPass)
 	{
 		auto cameraPos = Camera.pos.ToVector3();
@@ -3002,14 +3024,23 @@ namespace TEN::Renderer
 
 	void Renderer::DrawSortedFaces(RenderView& view)
 	{
-		std::sort(
-			view.TransparentObjectsToDraw.begin(),
-			view.TransparentObjectsToDraw.end(),
-			[](RendererSortableObject& a, RendererSortableObject& b)
-			{
-				return (a.Distance > b.Distance);
-			}
-		);
+		auto time1 = std::chrono::high_resolution_clock::now();
+
+		// Sort back to front. Key is inverted distance, so that ascending radix sort can be used.
+		_sortKeys.resize(view.TransparentObjectsToDraw.size());
+		for (int i = 0; i < view.TransparentObjectsToDraw.size(); i++)
+			_sortKeys[i] = Utils::SortKey{ UINT_MAX - (unsigned int)std::max(view.TransparentObjectsToDraw[i].Distance, 0), i };
+
+		Utils::RadixSort(_sortKeys, _sortKeysBuffer);
+
+		_sortedTransparentObjects.clear();
+		for (const auto& key : _sortKeys)
+			_sortedTransparentObjects.push_back(view.TransparentObjectsToDraw[key.Index]);
+
+		std::swap(view.TransparentObjectsToDraw, _sortedTransparentObjects);
+
+		auto time2 = std::chrono::high_resolution_clock::now();
+		_timeSort += (int)std::chrono::duration_cast<std::chrono::microseconds>(time2 - time1).count();
 
 		for (int i = 0; i < view.TransparentObjectsToDraw.size(); i++)
 		{
@@ -53,7 +53,7 @@ extern SHOCKWAVE_STRUCT ShockWaves[MAX_SHOCKWAVE];
 extern FIRE_LIST Fires[MAX_FIRE_LIST];
 extern Particle Particles[MAX_PARTICLES];
 extern SPLASH_STRUCT Splashes[MAX_SPLASHES];
-extern std::array<DebrisFragment, MAX_DEBRIS> DebrisFragments;
+extern DebrisFragmentData DebrisFragments;
 
 namespace TEN::Renderer 
 {
@@ -337,14 +337,6 @@ namespace TEN::Renderer
 					const auto& fx = EffectList[particle.fxObj];
 
 					pos += fx.pos.Position.ToVector3();
-
-					if ((particle.sLife - particle.life) > Random::GenerateInt(8, 12))
-					{
-						particle.flags &= ~SP_FX;
-						particle.x = pos.x;
-						particle.y = pos.y;
-						particle.z = pos.z;
-					}
 				}
 				else if (!(particle.flags & SP_ITEM))
 				{
@@ -380,14 +372,6 @@ namespace TEN::Renderer
 						}
 
 						pos += nodePos.ToVector3();
-
-						if ((particle.sLife - particle.life) > Random::GenerateInt(4, 8))
-						{
-							particle.flags &= ~SP_ITEM;
-							particle.x = pos.x;
-							particle.y = pos.y;
-							particle.z = pos.z;
-						}
 					}
 					else
 					{
@@ -1206,76 +1190,65 @@ namespace TEN::Renderer
 
 	void Renderer::DrawDebris(RenderView& view, RendererPass rendererPass)
 	{
-		std::vector<Vertex> vertices;
-
-		bool activeDebrisExist = false;
-		for (auto& deb : DebrisFragments)
-		{
-			if (deb.active)
-			{
-				activeDebrisExist = true;
-				break;
-			}
-		}
+		const auto& debris = DebrisFragments;
 
-		if (activeDebrisExist)
+		if (debris.Count > 0)
 		{
 			_context->VSSetShader(_vsStatics.Get(), nullptr, 0);
 			_context->PSSetShader(_psStatics.Get(), nullptr, 0);
 
 			SetCullMode(CullMode::None);
 
-			for (auto& deb : DebrisFragments)
+			for (int i = 0; i < debris.Count; i++)
 			{
-				if (deb.active)
-				{
-					if (!SetupBlendModeAndAlphaTest(deb.mesh.blendMode, rendererPass, 0))
-					{
-						continue;
-					}
+				const auto& mesh = debris.Meshes[i];
 
-					if (deb.isStatic)
-					{
-						BindTexture(TextureRegister::ColorMap, &std::get<0>(_staticTextures[deb.mesh.tex]), SamplerStateRegister::LinearClamp);
-					}
-					else
-					{
-						BindTexture(TextureRegister::ColorMap, &std::get<0>(_moveablesTextures[deb.mesh.tex]), SamplerStateRegister::LinearClamp);
-					}
-
-					_stStatic.World = deb.Transform;
-					_stStatic.Color = deb.color;
-					_stStatic.AmbientLight = _rooms[deb.roomNumber].AmbientLight;
-					_stStatic.LightMode = (int)deb.lightMode;
-
-					_cbStatic.UpdateData(_stStatic, _context.Get());
+				if (!SetupBlendModeAndAlphaTest(mesh.blendMode, rendererPass, 0))
+				{
+					continue;
+				}
 
-					Vertex vtx0;
-					vtx0.Position = deb.mesh.Positions[0];
-					vtx0.UV = deb.mesh.TextureCoordinates[0];
-					vtx0.Normal = deb.mesh.Normals[0];
-					vtx0.Color = deb.mesh.Colors[0];
-
-					Vertex vtx1;
-					vtx1.Position = deb.mesh.Positions[1];
-					vtx1.UV = deb.mesh.TextureCoordinates[1];
-					vtx1.Normal = deb.mesh.Normals[1];
-					vtx1.Color = deb.mesh.Colors[1];
-
-					Vertex vtx2;
-					vtx2.Position = deb.mesh.Positions[2];
-					vtx2.UV = deb.mesh.TextureCoordinates[2];
-					vtx2.Normal = deb.mesh.Normals[2];
-					vtx2.Color = deb.mesh.Colors[2];
-
-					_primitiveBatch->Begin();
-					_primitiveBatch->DrawTriangle(vtx0, vtx1, vtx2);
-					_primitiveBatch->End();
-
-					_numDebrisDrawCalls++;
-					_numDrawCalls++;
-					_numTriangles++;
+				if (debris.IsStatic[i])
+				{
+					BindTexture(TextureRegister::ColorMap, &std::get<0>(_staticTextures[mesh.tex]), SamplerStateRegister::LinearClamp);
 				}
+				else
+				{
+					BindTexture(TextureRegister::ColorMap, &std::get<0>(_moveablesTextures[mesh.tex]), SamplerStateRegister::LinearClamp);
+				}
+
+				_stStatic.World = debris.Transforms[i];
+				_stStatic.Color = debris.Colors[i];
+				_stStatic.AmbientLight = _rooms[debris.RoomNumbers[i]].AmbientLight;
+				_stStatic.LightMode = (int)debris.LightModes[i];
+
+				_cbStatic.UpdateData(_stStatic, _context.Get());
+
+				Vertex vtx0;
+				vtx0.Position = mesh.Positions[0];
+				vtx0.UV = mesh.TextureCoordinates[0];
+				vtx0.Normal = mesh.Normals[0];
+				vtx0.Color = mesh.Colors[0];
+
+				Vertex vtx1;
+				vtx1.Position = mesh.Positions[1];
+				vtx1.UV = mesh.TextureCoordinates[1];
+				vtx1.Normal = mesh.Normals[1];
+				vtx1.Color = mesh.Colors[1];
+
+				Vertex vtx2;
+				vtx2.Position = mesh.Positions[2];
+				vtx2.UV = mesh.TextureCoordinates[2];
+				vtx2.Normal = mesh.Normals[2];
+				vtx2.Color = mesh.Colors[2];
+
+				_primitiveBatch->Begin();
+				_primitiveBatch->DrawTriangle(vtx0, vtx1, vtx2);
+				_primitiveBatch->End();
+
+				_numDebrisDrawCalls++;
+				_numDrawCalls++;
+				_numTriangles++;
 			}
 
 			// TODO: temporary fix, we need to remove every use of SpriteBatch and PrimitiveBatch because
@@ -2,7 +2,11 @@
 #include "Renderer/Renderer.h"
 
 #include "Game/animation.h"
+#include "Game/collision/Point.h"
+#include "Game/collision/Sphere.h"
 #include "Game/control/control.h"
+#include "Game/control/CreatureScheduler.h"
+#include "Game/control/CreatureSensing.h"
 #include "Game/control/volume.h"
 #include "Game/Gui.h"
 #include "Game/Hud/Hud.h"
@@ -12,10 +16,15 @@
 #include "Math/Math.h"
 #include "Scripting/Internal/TEN/Flow//Level/FlowLevel.h"
 #include "Specific/configuration.h"
+#include "Specific/Input/InputSampler.h"
 #include "Specific/level.h"
 #include "Specific/trutils.h"
 #include "Specific/winmain.h"
 
+using namespace TEN::Collision::Point;
+using namespace TEN::Collision::Sphere;
+using namespace TEN::Control::Scheduler;
+using namespace TEN::Control::Sensing;
 using namespace TEN::Gui;
 using namespace TEN::Hud;
 using namespace TEN::Input;
@@ -1176,6 +1185,8 @@ namespace TEN::Renderer
 			PrintDebugMessage("Frame time: %d", _timeFrame);
 			PrintDebugMessage("ControlPhase() time: %d", ControlPhaseTime);
 			PrintDebugMessage("Room collector time: %d", _timeRoomsCollector);
+			PrintDebugMessage("Sort time (us): %d", _timeSort);
+			PrintDebugMessage("String time (us): %d, cached layouts: %d", _timeStrings, (int)_stringLayoutCache.size());
 			PrintDebugMessage("TOTAL draw calls: %d", _numDrawCalls);
 			PrintDebugMessage("    Rooms: %d", _numRoomsDrawCalls);
 			PrintDebugMessage("    Movables: %d", _numMoveablesDrawCalls);
@@ -1195,6 +1206,8 @@ namespace TEN::Renderer
 			PrintDebugMessage("Rooms: %d", view.RoomsToDraw.size());
 			PrintDebugMessage("    CheckPortal() calls: %d", _numCheckPortalCalls);
 			PrintDebugMessage("    GetVisibleRooms() calls: %d", _numGetVisibleRoomsCalls);
+			PrintDebugMessage("    PVS culled portals: %d", _numPvsCulledPortals);
+			PrintDebugMessage("    Memoized portals: %d", _numMemoizedPortals);
 			PrintDebugMessage("    Dot products: %d", _numDotProducts);
 
 			_spriteBatch->Begin(SpriteSortMode_Deferred, _renderStates->Opaque());
@@ -1299,10 +1312,26 @@ namespace TEN::Renderer
 			PrintDebugMessage("Camera axes: %.3f, %.3f", AxisMap[(int)InputAxis::Camera].x, AxisMap[(int)InputAxis::Camera].y);
 			PrintDebugMessage("Mouse axes: %.3f, %.3f", AxisMap[(int)InputAxis::Mouse].x, AxisMap[(int)InputAxis::Mouse].y);
 			PrintDebugMessage("Cursor pos: %.3f, %.3f", GetMouse2DPosition().x, GetMouse2DPosition().y);
+
+			if (IsInputSamplerActive())
+			{
+				auto samplerStats = GetInputSamplerStats();
+				PrintDebugMessage("Sampler samples: %d, events: %d", samplerStats.SampleCount, samplerStats.EventCount);
+				PrintDebugMessage("Sampler taps: %d, dropped: %d", samplerStats.TapCount, samplerStats.DroppedEventCount);
+				PrintDebugMessage("Sampler latency: %.3f ms (max %.3f ms)", samplerStats.AverageLatency, samplerStats.MaxLatency);
+			}
 		}
 			break;
 
 		case RendererDebugPage::CollisionStats:
+		{
+			auto probeCacheStats = GetPointCollisionCacheStats();
+			unsigned int probeCount = probeCacheStats.HitCount + probeCacheStats.MissCount;
+
+			auto sphereCacheStats = GetItemSphereCacheStats();
+			double sphereComputeTime = (sphereCacheStats.ComputeCount != 0) ? (sphereCacheStats.ComputeTime / sphereCacheStats.ComputeCount) : 0.0;
+			double sphereSavedTime = sphereComputeTime * (sphereCacheStats.QueryCount - sphereCacheStats.ComputeCount);
+
 			PrintDebugMessage("COLLISION STATS");
 			PrintDebugMessage("Collision type: %d", LaraCollision.CollisionType);
 			PrintDebugMessage("Bridge item ID: %d", LaraCollision.Middle.Bridge);
@@ -1312,11 +1341,38 @@ namespace TEN::Renderer
 			PrintDebugMessage("Front ceil: %d", LaraCollision.Front.Ceiling);
 			PrintDebugMessage("Front left ceil: %d", LaraCollision.FrontLeft.Ceiling);
 			PrintDebugMessage("Front right ceil: %d", LaraCollision.FrontRight.Ceiling);
+			PrintDebugMessage("Probe cache hits: %d / %d (%.1f%%)", probeCacheStats.HitCount, probeCount,
+				(probeCount != 0) ? ((probeCacheStats.HitCount * 100.0f) / probeCount) : 0.0f);
+			PrintDebugMessage("Probes: %d, batched: %d, shared traversals: %d", probeCacheStats.ProbeCount,
+				probeCacheStats.BatchProbeCount, probeCacheStats.SharedTraversalCount);
+			PrintDebugMessage("Probe time (us): %.1f (debug builds and -benchmark only)", probeCacheStats.ProbeTime);
+			PrintDebugMessage("Sphere queries: %d, computed: %d", sphereCacheStats.QueryCount, sphereCacheStats.ComputeCount);
+			PrintDebugMessage("Sphere time (us): %.1f, saved (est.): %.1f", sphereCacheStats.ComputeTime, sphereSavedTime);
+		}
 			break;
 
 		case RendererDebugPage::PathfindingStats:
+		{
+			constexpr auto TIER_NAMES = std::array<const char*, CREATURE_LOD_TIER_COUNT>{ "None", "Low", "Medium", "High" };
+
+			auto sensingStats = GetCreatureSensingStats();
+			auto lodStats = GetCreatureLodStats();
+
 			PrintDebugMessage("PATHFINDING STATS");
 			PrintDebugMessage("BoxNumber: %d", LaraItem->BoxNumber);
+			PrintDebugMessage("Parallel sensing: %s", IsCreatureSensingEnabled() ? "on" : "off");
+			PrintDebugMessage("Sensed creatures: %d, reused: %d, stale: %d", sensingStats.CreatureCount,
+				sensingStats.ReuseCount, sensingStats.StaleCount);
+			PrintDebugMessage("Sense time (us): %.1f, control time (us): %.1f", sensingStats.SenseTime, sensingStats.ControlTime);
+
+			for (int i = CREATURE_LOD_TIER_COUNT - 1; i >= 0; i--)
+			{
+				const auto& tierStats = lodStats.Tiers[i];
+				PrintDebugMessage("AI LOD %s: %d creatures, %d updates, %d skips, %.1f us (stale <= %d)", TIER_NAMES[i],
+					tierStats.CreatureCount, tierStats.UpdateCount, tierStats.SkipCount, tierStats.ControlTime,
+					GetCreatureLodSettings().MaxStaleness[i]);
+			}
+		}
 			break;
 
 		case RendererDebugPage::WireframeMode:
@@ -14,6 +14,7 @@ using namespace DirectX::SimpleMath;
 #define PRINTSTRING_COLOR_YELLOW D3DCOLOR_ARGB(255, 240, 220, 32)
 
 constexpr auto MAX_LINES_2D		= 256;
+constexpr auto STRING_LAYOUT_CACHE_SIZE_MAX = 1024;
 constexpr auto MAX_LINES_3D		= 16384;
 constexpr auto MAX_TRIANGLES_3D = 16384;
 
@@ -28,6 +29,9 @@ constexpr auto MAX_DYNAMIC_SHADOWS = 1;
 constexpr auto MAX_DYNAMIC_LIGHTS = 1024;
 constexpr auto ITEM_LIGHT_COLLECTION_RADIUS = BLOCK(1);
 constexpr auto CAMERA_LIGHT_COLLECTION_RADIUS = BLOCK(4);
+constexpr auto LIGHT_COLLECTION_DISTANCE_MAX = BLOCK(20);
+constexpr auto LIGHT_GRID_CELL_SIZE = BLOCK(4);
+constexpr auto LIGHT_GRID_QUERY_RADIUS_MAX = CAMERA_LIGHT_COLLECTION_RADIUS;
 
 constexpr auto MAX_TRANSPARENT_FACES = 16384;
 constexpr auto MAX_TRANSPARENT_VERTICES = (MAX_TRANSPARENT_FACES * 6);
@@ -1,6 +1,8 @@
 #include "framework.h"
 #include "Renderer/Renderer.h"
 
+#include <execution>
+
 #include "Scripting/Include/Flow/ScriptInterfaceFlowHandler.h"
 #include "Game/animation.h"
 #include "Game/camera.h"
@@ -25,8 +27,6 @@ namespace TEN::Renderer
 	{
 		constexpr auto VIEW_PORT = Vector4(-1.0f, -1.0f, 1.0f, 1.0f);
 
-		_visitedRoomsStack.clear();
-
 		for (int i = 0; i < g_Level.Rooms.size(); i++)
 		{ 
 			auto& room = _rooms[i];
@@ -35,6 +35,7 @@ namespace TEN::Renderer
 			room.EffectsToDraw.clear();
 			room.StaticsToDraw.clear();
 			room.LightsToDraw.clear();
+			room.Entries.clear();
 			room.Visited = false;
 			room.ViewPort = VIEW_PORT;
 
@@ -48,6 +49,9 @@ namespace TEN::Renderer
 
 		GetVisibleRooms(NO_VALUE, renderView.Camera.RoomNumber, VIEW_PORT, false, 0, onlyRooms, renderView);
 
+		if (!onlyRooms)
+			CollectLightsForItemsAndEffects(renderView);
+
 		_invalidateCache = false; 
 
 		// Prepare real DX scissor test rectangle.
@@ -212,101 +216,255 @@ namespace TEN::Renderer
 		return true;
 	}
 
-	void Renderer::GetVisibleRooms(short from, short to, Vector4 viewPort, bool water, int count, bool onlyRooms, RenderView& renderView)
+	std::vector<bool> Renderer::ComputePotentiallyVisibleRooms(short roomNumber)
 	{
-		// FIXME: This is an urgent hack to fix stack overflow crashes.
-		// See https://github.com/MontyTRC89/TombEngine/issues/947 for details.
-		// NOTE by MontyTRC: I'd keep this as a failsafe solution for 0.00000001% of cases we could have problems
+		constexpr auto MAX_SEARCH_DEPTH	= 64;
+		constexpr auto MAX_SEARCH_STEPS	= 16384;
+		constexpr auto PLANE_EPSILON	= 1.0f;
 
-		int stackSize = (int)_visitedRoomsStack.size();
-		int stackMinIndex = std::max(0, int(stackSize - 5));
+		// Chain of portals leading from source room. Door normals point into room owning the door.
+		struct PortalNode
+		{
+			short FromRoomNumber;
+			short RoomNumber;
+			const RendererDoor* Door;
+			int Depth;
+			int ParentNodeIndex;
+		};
+
+		auto pvs = std::vector<bool>(_rooms.size(), false);
+		pvs[roomNumber] = true;
 
-		for (int i = stackSize - 1; i >= stackMinIndex; i--)
+		auto nodes = std::vector<PortalNode>{ PortalNode{ NO_VALUE, roomNumber, nullptr, 0, NO_VALUE } };
+		auto stack = std::vector<int>{ 0 };
+
+		while (!stack.empty())
 		{
-			if (_visitedRoomsStack[i] == to)
+			auto node = nodes[stack.back()];
+			int nodeIndex = stack.back();
+			stack.pop_back();
+
+			for (const auto& door : _rooms[node.RoomNumber].Doors)
 			{
-				TENLog("Circle detected! Room " + std::to_string(to), LogLevel::Warning, LogConfig::Debug);
-				return;
-			}
-		}
-		
-		static constexpr int MAX_SEARCH_DEPTH = 64;
-		if (_rooms[to].Visited && count > MAX_SEARCH_DEPTH)
-		{
-			TENLog("Maximum room collection depth of " + std::to_string(MAX_SEARCH_DEPTH) + 
-				   " was reached with room " + std::to_string(to), LogLevel::Warning, LogConfig::Debug);
-			return;
-		}
+				if (door.RoomNumber == node.FromRoomNumber)
+					continue;
 
-		_visitedRoomsStack.push_back(to);
+				// Portal can only be seen through chain if it extends behind every previous portal plane.
+				bool isOccluded = false;
+				bool isCircle = false;
+				for (int parentIndex = nodeIndex; parentIndex != NO_VALUE; parentIndex = nodes[parentIndex].ParentNodeIndex)
+				{
+					const auto& parentNode = nodes[parentIndex];
+					if (parentNode.RoomNumber == door.RoomNumber)
+					{
+						isCircle = true;
+						break;
+					}
 
-		_numGetVisibleRoomsCalls++;
+					if (parentNode.Door == nullptr)
+						continue;
 
-		RendererRoom* room = &_rooms[to];
+					auto planePoint = Vector3(parentNode.Door->AbsoluteVertices[0]);
 
-		if (!room->Visited)
-		{
-			room->Visited = true;
+					bool isBehind = false;
+					for (int i = 0; i < 4; i++)
+					{
+						if (parentNode.Door->Normal.Dot(Vector3(door.AbsoluteVertices[i]) - planePoint) <= PLANE_EPSILON)
+						{
+							isBehind = true;
+							break;
+						}
+					}
 
-			renderView.RoomsToDraw.push_back(room);
+					if (!isBehind)
+					{
+						isOccluded = true;
+						break;
+					}
+				}
 
-			CollectLightsForRoom(to, renderView);
+				if (isCircle || isOccluded)
+					continue;
 
-			if (!onlyRooms)
-			{
-				CollectItems(to, renderView);
-				CollectStatics(to, renderView);
-				CollectEffects(to);
+				// Too complex to resolve; fall back to all rooms.
+				if (node.Depth >= MAX_SEARCH_DEPTH || nodes.size() >= MAX_SEARCH_STEPS)
+				{
+					TENLog("Potentially visible set for room " + std::to_string(roomNumber) + " too complex, disabling culling.", LogLevel::Warning, LogConfig::Debug);
+					return std::vector<bool>(_rooms.size(), true);
+				}
+
+				pvs[door.RoomNumber] = true;
+
+				nodes.push_back(PortalNode{ node.RoomNumber, door.RoomNumber, &door, node.Depth + 1, nodeIndex });
+				stack.push_back((int)nodes.size() - 1);
 			}
 		}
 
-		room->ViewPort.x = std::min(room->ViewPort.x, viewPort.x);
-		room->ViewPort.y = std::min(room->ViewPort.y, viewPort.y);
-		room->ViewPort.z = std::max(room->ViewPort.z, viewPort.z);
-		room->ViewPort.w = std::max(room->ViewPort.w, viewPort.w);
+		return pvs;
+	}
+
+	const std::vector<bool>& Renderer::GetPotentiallyVisibleRooms(short roomNumber)
+	{
+		if (_potentiallyVisibleRooms.size() != _rooms.size())
+			_potentiallyVisibleRooms.resize(_rooms.size());
+
+		auto& pvs = _potentiallyVisibleRooms[roomNumber];
+		if (pvs.empty())
+			pvs = ComputePotentiallyVisibleRooms(roomNumber);
+
+		return pvs;
+	}
+
+	void Renderer::GetVisibleRooms(short from, short to, Vector4 viewPort, bool water, int count, bool onlyRooms, RenderView& renderView)
+	{
+		constexpr auto MAX_SEARCH_DEPTH	  = 64;
+		constexpr auto CIRCLE_SEARCH_DEPTH = 5;
+
+		// Portals leading to rooms outside potentially visible set of start room are never traversed.
+		const auto& pvs = GetPotentiallyVisibleRooms(to);
+
+		_roomNodes.clear();
+		_roomNodeStack.clear();
 
-		Vector4 clipPort;
-		for (int i = 0; i < room->Doors.size(); i++)
+		_roomNodes.push_back(RendererRoomNode{ from, to, viewPort, count, NO_VALUE });
+		_roomNodeStack.push_back(0);
+
+		while (!_roomNodeStack.empty())
 		{
-			RendererDoor* door = &room->Doors[i];
+			int nodeIndex = _roomNodeStack.back();
+			auto node = _roomNodes[nodeIndex];
+			_roomNodeStack.pop_back();
+
+			// FIXME: This is an urgent hack to fix stack overflow crashes.
+			// See https://github.com/MontyTRC89/TombEngine/issues/947 for details.
+			// NOTE by MontyTRC: I'd keep this as a failsafe solution for 0.00000001% of cases we could have problems
+
+			bool isCircle = false;
+			int parentIndex = node.ParentNodeIndex;
+			for (int i = 0; i < CIRCLE_SEARCH_DEPTH && parentIndex != NO_VALUE; i++)
+			{
+				if (_roomNodes[parentIndex].RoomNumber == node.RoomNumber)
+				{
+					isCircle = true;
+					break;
+				}
+
+				parentIndex = _roomNodes[parentIndex].ParentNodeIndex;
+			}
 
-			if (door->InvisibleFromCamera)
+			if (isCircle)
 			{
+				TENLog("Circle detected! Room " + std::to_string(node.RoomNumber), LogLevel::Warning, LogConfig::Debug);
 				continue;
 			}
 
-			if (!door->Visited)
+			if (_rooms[node.RoomNumber].Visited && node.Depth > MAX_SEARCH_DEPTH)
 			{
-				door->CameraToDoor = Vector3(
-					Camera.pos.x - (door->AbsoluteVertices[0].x),
-					Camera.pos.y - (door->AbsoluteVertices[0].y),
-					Camera.pos.z - (door->AbsoluteVertices[0].z));
-				door->CameraToDoor.Normalize();
+				TENLog("Maximum room collection depth of " + std::to_string(MAX_SEARCH_DEPTH) +
+					   " was reached with room " + std::to_string(node.RoomNumber), LogLevel::Warning, LogConfig::Debug);
+				continue;
 			}
 
-			// IMPORTANT: dot = 0 would generate ambiguity becase door could be traversed in both directions, potentially 
-			// generating endless loops. We need to exclude this.
+			RendererRoom* room = &_rooms[node.RoomNumber];
 
-			if (door->DotProduct == FLT_MAX)
+			// Skip if room was already entered from same room through view port enclosing current one.
+			bool isCovered = false;
+			for (const auto& entry : room->Entries)
 			{
-				door->DotProduct = 
-					door->Normal.x * door->CameraToDoor.x +
-					door->Normal.y * door->CameraToDoor.y +
-					door->Normal.z * door->CameraToDoor.z;
-				_numDotProducts++;
+				if (entry.FromRoomNumber == node.FromRoomNumber &&
+					entry.ViewPort.x <= node.ViewPort.x && entry.ViewPort.y <= node.ViewPort.y &&
+					entry.ViewPort.z >= node.ViewPort.z && entry.ViewPort.w >= node.ViewPort.w)
+				{
+					isCovered = true;
+					break;
+				}
 			}
 
-			if (door->DotProduct < 0)
+			if (isCovered)
 			{
-				door->InvisibleFromCamera = true;
+				_numMemoizedPortals++;
 				continue;
 			}
 
-			if (from != door->RoomNumber && CheckPortal(to, door, viewPort, &clipPort, renderView))
-				GetVisibleRooms(to, door->RoomNumber, clipPort, water, count + 1, onlyRooms, renderView);
-		}
+			room->Entries.push_back(RendererRoomEntry{ node.FromRoomNumber, node.ViewPort });
+
+			_numGetVisibleRoomsCalls++;
 
-		_visitedRoomsStack.pop_back();
+			if (!room->Visited)
+			{
+				room->Visited = true;
+
+				renderView.RoomsToDraw.push_back(room);
+
+				CollectLightsForRoom(node.RoomNumber, renderView);
+
+				if (!onlyRooms)
+				{
+					CollectItems(node.RoomNumber, renderView);
+					CollectStatics(node.RoomNumber, renderView);
+					CollectEffects(node.RoomNumber);
+				}
+			}
+
+			room->ViewPort.x = std::min(room->ViewPort.x, node.ViewPort.x);
+			room->ViewPort.y = std::min(room->ViewPort.y, node.ViewPort.y);
+			room->ViewPort.z = std::max(room->ViewPort.z, node.ViewPort.z);
+			room->ViewPort.w = std::max(room->ViewPort.w, node.ViewPort.w);
+
+			// Doors are pushed in reverse so that rooms are traversed in same order as before.
+			Vector4 clipPort;
+			for (int i = (int)room->Doors.size() - 1; i >= 0; i--)
+			{
+				RendererDoor* door = &room->Doors[i];
+
+				if (door->InvisibleFromCamera)
+				{
+					continue;
+				}
+
+				if (!door->Visited)
+				{
+					door->CameraToDoor = Vector3(
+						Camera.pos.x - (door->AbsoluteVertices[0].x),
+						Camera.pos.y - (door->AbsoluteVertices[0].y),
+						Camera.pos.z - (door->AbsoluteVertices[0].z));
+					door->CameraToDoor.Normalize();
+				}
+
+				// IMPORTANT: dot = 0 would generate ambiguity becase door could be traversed in both directions, potentially 
+				// generating endless loops. We need to exclude this.
+
+				if (door->DotProduct == FLT_MAX)
+				{
+					door->DotProduct = 
+						door->Normal.x * door->CameraToDoor.x +
+						door->Normal.y * door->CameraToDoor.y +
+						door->Normal.z * door->CameraToDoor.z;
+					_numDotProducts++;
+				}
+
+				if (door->DotProduct < 0)
+				{
+					door->InvisibleFromCamera = true;
+					continue;
+				}
+
+				if (node.FromRoomNumber == door->RoomNumber)
+					continue;
+
+				if (!pvs[door->RoomNumber])
+				{
+					_numPvsCulledPortals++;
+					continue;
+				}
+
+				if (CheckPortal(node.RoomNumber, door, node.ViewPort, &clipPort, renderView))
+				{
+					_roomNodes.push_back(RendererRoomNode{ node.RoomNumber, door->RoomNumber, clipPort, node.Depth + 1, nodeIndex });
+					_roomNodeStack.push_back((int)_roomNodes.size() - 1);
+				}
+			}
+		}
 	}
 
 	void Renderer::CollectItems(short roomNumber, RenderView& renderView)
@@ -386,7 +544,6 @@ namespace TEN::Renderer
 			newItem->World = newItem->Rotation * newItem->Translation;
 
 			CalculateLightFades(newItem);
-			CollectLightsForItem(newItem);
 
 			room.ItemsToDraw.push_back(newItem);
 		}
@@ -478,6 +635,116 @@ namespace TEN::Renderer
 		}
 	}
 
+	int Renderer::GetLightGridCellIndex(int x, int z) const
+	{
+		int cellX = std::clamp((x - _lightGrid.OriginX) / LIGHT_GRID_CELL_SIZE, 0, _lightGrid.Width - 1);
+		int cellZ = std::clamp((z - _lightGrid.OriginZ) / LIGHT_GRID_CELL_SIZE, 0, _lightGrid.Depth - 1);
+		return ((cellZ * _lightGrid.Width) + cellX);
+	}
+
+	// Calls function for all grid cells which light can reach from positions within max query radius.
+	template <typename TFunc>
+	static void ForEachLightGridCell(const RendererLightGrid& grid, const RendererLight& light, TFunc func)
+	{
+		float extent = std::min(light.Out + LIGHT_GRID_QUERY_RADIUS_MAX, (float)LIGHT_COLLECTION_DISTANCE_MAX);
+
+		int cellXMin = std::clamp(((int)floor(light.Position.x - extent) - grid.OriginX) / LIGHT_GRID_CELL_SIZE, 0, grid.Width - 1);
+		int cellXMax = std::clamp(((int)ceil(light.Position.x + extent) - grid.OriginX) / LIGHT_GRID_CELL_SIZE, 0, grid.Width - 1);
+		int cellZMin = std::clamp(((int)floor(light.Position.z - extent) - grid.OriginZ) / LIGHT_GRID_CELL_SIZE, 0, grid.Depth - 1);
+		int cellZMax = std::clamp(((int)ceil(light.Position.z + extent) - grid.OriginZ) / LIGHT_GRID_CELL_SIZE, 0, grid.Depth - 1);
+
+		for (int cellZ = cellZMin; cellZ <= cellZMax; cellZ++)
+		{
+			for (int cellX = cellXMin; cellX <= cellXMax; cellX++)
+				func((cellZ * grid.Width) + cellX);
+		}
+	}
+
+	void Renderer::BuildRoomLightGrid()
+	{
+		auto& grid = _lightGrid;
+
+		auto boundsMin = Vector3(FLT_MAX);
+		auto boundsMax = Vector3(-FLT_MAX);
+		for (const auto& room : _rooms)
+		{
+			boundsMin = Vector3::Min(boundsMin, room.BoundingBox.Center - room.BoundingBox.Extents);
+			boundsMax = Vector3::Max(boundsMax, room.BoundingBox.Center + room.BoundingBox.Extents);
+		}
+
+		if (_rooms.empty())
+			boundsMin = boundsMax = Vector3::Zero;
+
+		// Positions outside of level bounds are clamped to border cells, both when inserting lights and when querying.
+		grid.OriginX = (int)floor(boundsMin.x);
+		grid.OriginZ = (int)floor(boundsMin.z);
+		grid.Width = ((int)ceil(boundsMax.x) - grid.OriginX) / LIGHT_GRID_CELL_SIZE + 1;
+		grid.Depth = ((int)ceil(boundsMax.z) - grid.OriginZ) / LIGHT_GRID_CELL_SIZE + 1;
+
+		grid.RoomLightCells.clear();
+		grid.RoomLightCells.resize(grid.Width * grid.Depth);
+		grid.DynamicLightCells.clear();
+		grid.DynamicLightCells.resize(grid.Width * grid.Depth);
+		grid.UsedDynamicCells.clear();
+		grid.RoomSunLights.clear();
+		grid.RoomSunLights.resize(_rooms.size());
+
+		for (int roomNumber = 0; roomNumber < _rooms.size(); roomNumber++)
+		{
+			for (auto& light : _rooms[roomNumber].Lights)
+			{
+				if (light.Type == LightType::Sun)
+				{
+					grid.RoomSunLights[roomNumber].push_back(&light);
+				}
+				else if (light.Type == LightType::Point || light.Type == LightType::Shadow || light.Type == LightType::Spot)
+				{
+					ForEachLightGridCell(grid, light, [&](int cellIndex)
+					{
+						grid.RoomLightCells[cellIndex].push_back(RendererLightGridNode{ &light, roomNumber });
+					});
+				}
+			}
+		}
+
+		grid.IsRoomLightsBuilt = true;
+	}
+
+	void Renderer::UpdateLightGrid()
+	{
+		if (!_lightGrid.IsRoomLightsBuilt)
+			BuildRoomLightGrid();
+
+		for (int cellIndex : _lightGrid.UsedDynamicCells)
+			_lightGrid.DynamicLightCells[cellIndex].clear();
+
+		_lightGrid.UsedDynamicCells.clear();
+
+		for (auto& light : _dynamicLights)
+		{
+			ForEachLightGridCell(_lightGrid, light, [&](int cellIndex)
+			{
+				auto& cell = _lightGrid.DynamicLightCells[cellIndex];
+				if (cell.empty())
+					_lightGrid.UsedDynamicCells.push_back(cellIndex);
+
+				cell.push_back(&light);
+			});
+		}
+	}
+
+	int Renderer::CollectLightsAtPosition(const Vector3& pos, int roomNumber, bool useLightGrid)
+	{
+		bool prevUseLightGrid = _useLightGrid;
+		_useLightGrid = useLightGrid;
+
+		auto lights = std::vector<RendererLight*>{};
+		CollectLights(pos, ITEM_LIGHT_COLLECTION_RADIUS, roomNumber, NO_VALUE, false, false, nullptr, &lights);
+
+		_useLightGrid = prevUseLightGrid;
+		return (int)lights.size();
+	}
+
 	void Renderer::CollectLights(Vector3 position, float radius, int roomNumber, int prevRoomNumber, bool prioritizeShadowLight, bool useCachedRoomLights, std::vector<RendererLightNode>* roomsLights, std::vector<RendererLight*>* outputLights)
 	{
 		if (_rooms.size() < roomNumber)
@@ -494,8 +761,11 @@ namespace TEN::Renderer
 		RendererLight* brightestLight = nullptr;
 		float brightest = 0.0f;
 
-		// Dynamic lights have the priority
-		for (auto& light : _dynamicLights)
+		// Light grid gives same candidates as full scan for query radii it was built for.
+		bool useLightGrid = _useLightGrid && _lightGrid.IsRoomLightsBuilt && radius <= LIGHT_GRID_QUERY_RADIUS_MAX;
+		int cellIndex = useLightGrid ? GetLightGridCellIndex((int)position.x, (int)position.z) : NO_VALUE;
+
+		auto collectDynamicLight = [&](RendererLight& light)
 		{
 			float distanceSquared =
 				SQUARE(position.x - light.Position.x) +
@@ -503,15 +773,15 @@ namespace TEN::Renderer
 				SQUARE(position.z - light.Position.z);
 
 			// Collect only lights nearer than 20 sectors
-			if (distanceSquared >= SQUARE(BLOCK(20)))
+			if (distanceSquared >= SQUARE(LIGHT_COLLECTION_DISTANCE_MAX))
 			{
-				continue;
+				return;
 			}
 
 			// Check the out radius
 			if (distanceSquared > SQUARE(light.Out + radius))
 			{
-				continue;
+				return;
 			}
 
 			float distance = sqrt(distanceSquared);
@@ -520,115 +790,151 @@ namespace TEN::Renderer
 
 			RendererLightNode node = { &light, intensity, distance, 1 };
 			tempLights.push_back(node);
-		}
-	
-		if (!useCachedRoomLights)
+		};
+
+		auto collectRoomLight = [&](RendererLight* light, int roomToCheck)
 		{
-			// Check current room and also neighbour rooms
-			for (int roomToCheck : room.Neighbors)
+			float intensity = 0;
+			float distance = 0;
+
+			// Check only lights different from sun
+			if (light->Type == LightType::Sun)
 			{
-				RendererRoom& currentRoom = _rooms[roomToCheck];
-				int numLights = (int)currentRoom.Lights.size();
+				// Suns from non-adjacent rooms are not added!
+				if (roomToCheck != roomNumber && (prevRoomNumber != roomToCheck || prevRoomNumber == NO_VALUE))
+				{
+					return;
+				}
 
-				for (int j = 0; j < numLights; j++)
+				// Sun is added without distance checks
+				intensity = light->Intensity * Luma(light->Color);						
+			}
+			else if (light->Type == LightType::Point || light->Type == LightType::Shadow)
+			{
+				float distanceSquared =
+					SQUARE(position.x - light->Position.x) +
+					SQUARE(position.y - light->Position.y) +
+					SQUARE(position.z - light->Position.z);
+
+				// Collect only lights nearer than 20 sectors
+				if (distanceSquared >= SQUARE(LIGHT_COLLECTION_DISTANCE_MAX))
 				{
-					RendererLight* light = &currentRoom.Lights[j];
+					return;
+				}
 
-					float intensity = 0;
-					float distance = 0;
+				// Check the out radius
+				if (distanceSquared > SQUARE(light->Out + radius))
+				{
+					return;
+				}
 
-					// Check only lights different from sun
-					if (light->Type == LightType::Sun)
-					{
-						// Suns from non-adjacent rooms are not added!
-						if (roomToCheck != roomNumber && (prevRoomNumber != roomToCheck || prevRoomNumber == NO_VALUE))
-						{
-							continue;
-						}
+				distance = sqrt(distanceSquared);
+				float attenuation = 1.0f - distance / light->Out;
+				intensity = attenuation * light->Intensity * Luma(light->Color);
 
-						// Sun is added without distance checks
-						intensity = light->Intensity * Luma(light->Color);						
-					}
-					else if (light->Type == LightType::Point || light->Type == LightType::Shadow)
+				// If collecting shadows, try to collect shadow casting light
+				if (light->CastShadows && prioritizeShadowLight && light->Type == LightType::Point)
+				{
+					if (intensity >= brightest)
 					{
-						float distanceSquared =
-							SQUARE(position.x - light->Position.x) +
-							SQUARE(position.y - light->Position.y) +
-							SQUARE(position.z - light->Position.z);
+						brightest = intensity;
+						brightestLight = light;
+					}
+				}
+			}
+			else if (light->Type == LightType::Spot)
+			{
+				float distanceSquared =
+					SQUARE(position.x - light->Position.x) +
+					SQUARE(position.y - light->Position.y) +
+					SQUARE(position.z - light->Position.z);
 
-						// Collect only lights nearer than 20 sectors
-						if (distanceSquared >= SQUARE(BLOCK(20)))
-						{
-							continue;
-						}
+				// Collect only lights nearer than 20 sectors
+				if (distanceSquared >= SQUARE(LIGHT_COLLECTION_DISTANCE_MAX))
+				{
+					return;
+				}
 
-						// Check the out radius
-						if (distanceSquared > SQUARE(light->Out + radius))
-						{
-							continue;
-						}
+				// Check the range
+				if (distanceSquared > SQUARE(light->Out + radius))
+				{
+					return;
+				}
 
-						distance = sqrt(distanceSquared);
-						float attenuation = 1.0f - distance / light->Out;
-						intensity = attenuation * light->Intensity * Luma(light->Color);
+				distance = sqrt(distanceSquared);
+				float attenuation = 1.0f - distance / light->Out;
+				intensity = attenuation * light->Intensity * light->Luma;
 
-						// If collecting shadows, try to collect shadow casting light
-						if (light->CastShadows && prioritizeShadowLight && light->Type == LightType::Point)
-						{
-							if (intensity >= brightest)
-							{
-								brightest = intensity;
-								brightestLight = light;
-							}
-						}
-					}
-					else if (light->Type == LightType::Spot)
+				// If shadow pointer provided, try to collect shadow casting light
+				if (light->CastShadows && prioritizeShadowLight)
+				{
+					if (intensity >= brightest)
 					{
-						float distanceSquared =
-							SQUARE(position.x - light->Position.x) +
-							SQUARE(position.y - light->Position.y) +
-							SQUARE(position.z - light->Position.z);
+						brightest = intensity;
+						brightestLight = light;
+					}
+				}
+			}
+			else
+			{
+				// Invalid light type
+				return;
+			}
 
-						// Collect only lights nearer than 20 sectors
-						if (distanceSquared >= SQUARE(BLOCK(20)))
-						{
-							continue;
-						}
+			RendererLightNode node = { light, intensity, distance, 0 };
 
-						// Check the range
-						if (distanceSquared > SQUARE(light->Out + radius))
-						{
-							continue;
-						}
+			if (roomsLights != nullptr)
+			{
+				roomsLights->push_back(node);
+			}
 
-						distance = sqrt(distanceSquared);
-						float attenuation = 1.0f - distance / light->Out;
-						intensity = attenuation * light->Intensity * light->Luma;
+			tempLights.push_back(node);
+		};
 
-						// If shadow pointer provided, try to collect shadow casting light
-						if (light->CastShadows && prioritizeShadowLight)
-						{
-							if (intensity >= brightest)
-							{
-								brightest = intensity;
-								brightestLight = light;
-							}
-						}
-					}
-					else
+		// Dynamic lights have the priority
+		if (useLightGrid)
+		{
+			for (auto* light : _lightGrid.DynamicLightCells[cellIndex])
+				collectDynamicLight(*light);
+		}
+		else
+		{
+			for (auto& light : _dynamicLights)
+				collectDynamicLight(light);
+		}
+	
+		if (!useCachedRoomLights)
+		{
+			if (useLightGrid)
+			{
+				// Only suns of current and previous room can pass, and only if they are in neighbour list.
+				for (int roomToCheck : { roomNumber, (prevRoomNumber != roomNumber) ? prevRoomNumber : NO_VALUE })
+				{
+					if (roomToCheck == NO_VALUE ||
+						std::find(room.Neighbors.begin(), room.Neighbors.end(), roomToCheck) == room.Neighbors.end())
 					{
-						// Invalid light type
 						continue;
 					}
 
-					RendererLightNode node = { light, intensity, distance, 0 };
+					for (auto* light : _lightGrid.RoomSunLights[roomToCheck])
+						collectRoomLight(light, roomToCheck);
+				}
 
-					if (roomsLights != nullptr)
-					{
-						roomsLights->push_back(node);
-					}
+				for (const auto& node : _lightGrid.RoomLightCells[cellIndex])
+				{
+					if (std::find(room.Neighbors.begin(), room.Neighbors.end(), node.RoomNumber) == room.Neighbors.end())
+						continue;
 
-					tempLights.push_back(node);
+					collectRoomLight(node.Light, node.RoomNumber);
+				}
+			}
+			else
+			{
+				// Check current room and also neighbour rooms
+				for (int roomToCheck : room.Neighbors)
+				{
+					for (auto& light : _rooms[roomToCheck].Lights)
+						collectRoomLight(&light, roomToCheck);
 				}
 			}
 		}
@@ -697,6 +1003,31 @@ namespace TEN::Renderer
 		}
 	}	
 	
+	void Renderer::CollectLightsForItemsAndEffects(RenderView& renderView)
+	{
+		_itemsToPrepare.clear();
+		_effectsToPrepare.clear();
+
+		for (const auto* room : renderView.RoomsToDraw)
+		{
+			_itemsToPrepare.insert(_itemsToPrepare.end(), room->ItemsToDraw.begin(), room->ItemsToDraw.end());
+			_effectsToPrepare.insert(_effectsToPrepare.end(), room->EffectsToDraw.begin(), room->EffectsToDraw.end());
+		}
+
+		// Light collection only reads shared light data and writes own light list, so items and effects are processed in parallel.
+		std::for_each(std::execution::par, _itemsToPrepare.begin(), _itemsToPrepare.end(),
+			[this](RendererItem* item)
+			{
+				CollectLightsForItem(item);
+			});
+
+		std::for_each(std::execution::par, _effectsToPrepare.begin(), _effectsToPrepare.end(),
+			[this](RendererEffect* effect)
+			{
+				CollectLightsForEffect(effect->RoomNumber, effect);
+			});
+	}
+
 	void Renderer::CollectLightsForEffect(short roomNumber, RendererEffect* effect)
 	{
 		CollectLights(effect->Position, ITEM_LIGHT_COLLECTION_RADIUS, roomNumber, NO_VALUE, false, false, nullptr, &effect->LightsToDraw);
@@ -820,8 +1151,6 @@ namespace TEN::Renderer
 			newEffect->World = rotation * translation;
 			newEffect->Mesh = GetMesh(obj->nmeshes ? obj->meshIndex : fx->frameNumber);
 
-			CollectLightsForEffect(fx->roomNumber, newEffect);
-
 			room.EffectsToDraw.push_back(newEffect);
 		}
 	}
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <ctime>
+#include <execution>
 #include <filesystem>
 #include <ScreenGrab.h>
 #include <wincodec.h>
@@ -44,7 +45,7 @@ namespace TEN::Renderer
 {
 	void Renderer::UpdateAnimation(RendererItem* rItem, RendererObject& rObject, const AnimFrameInterpData& frameData, int mask, bool useObjectWorldRotation)
 	{
-		static auto boneIndices = std::vector<int>{};
+		thread_local auto boneIndices = std::vector<int>{};
 		boneIndices.clear();
 		
 		RendererBone* bones[MAX_BONES] = {};
@@ -174,6 +175,7 @@ namespace TEN::Renderer
 			return;
 
 		itemToDraw->DoneAnimations = true;
+		itemToDraw->AnimationRevision++;
 
 		auto* obj = &Objects[nativeItem->ObjectNumber];
 		auto& moveableObj = *_moveableObjects[nativeItem->ObjectNumber];
@@ -320,9 +322,12 @@ namespace TEN::Renderer
 
 	void Renderer::UpdateItemAnimations(RenderView& view)
 	{
+		_itemsToPrepare.clear();
+		_itemAnimationJobs.clear();
+
 		for (const auto* room : view.RoomsToDraw)
 		{
-			for (const auto* itemToDraw : room->ItemsToDraw)
+			for (auto* itemToDraw : room->ItemsToDraw)
 			{
 				const auto& nativeItem = g_Level.Items[itemToDraw->ItemNumber];
 
@@ -330,9 +335,32 @@ namespace TEN::Renderer
 				if (nativeItem.ObjectNumber == ID_LARA)
 					continue;
 
-				UpdateItemAnimations(itemToDraw->ItemNumber, false);
+				_itemsToPrepare.push_back(itemToDraw);
 			}
 		}
+
+		// Bone extra rotations are stored per object, so items sharing object are animated in same job.
+		std::stable_sort(
+			_itemsToPrepare.begin(), _itemsToPrepare.end(),
+			[](const RendererItem* item0, const RendererItem* item1)
+			{
+				return (g_Level.Items[item0->ItemNumber].ObjectNumber < g_Level.Items[item1->ItemNumber].ObjectNumber);
+			});
+
+		for (int i = 0; i < _itemsToPrepare.size(); i++)
+		{
+			if (i == 0 || g_Level.Items[_itemsToPrepare[i]->ItemNumber].ObjectNumber != g_Level.Items[_itemsToPrepare[i - 1]->ItemNumber].ObjectNumber)
+				_itemAnimationJobs.push_back(std::pair(i, i));
+
+			_itemAnimationJobs.back().second = i + 1;
+		}
+
+		std::for_each(std::execution::par, _itemAnimationJobs.begin(), _itemAnimationJobs.end(),
+			[this](const std::pair<int, int>& job)
+			{
+				for (int i = job.first; i < job.second; i++)
+					UpdateItemAnimations(_itemsToPrepare[i]->ItemNumber, false);
+			});
 	}
 
 	void Renderer::BuildHierarchyRecursive(RendererObject *obj, RendererBone *node, RendererBone *parentNode)
@@ -390,6 +418,8 @@ namespace TEN::Renderer
 		_rooms[roomNumber1].RoomNumber = roomNumber1;
 		_rooms[roomNumber2].RoomNumber = roomNumber2;
 
+		_potentiallyVisibleRooms.clear();
+		_lightGrid.IsRoomLightsBuilt = false;
 		_invalidateCache = true;
 	}
 
@@ -413,15 +443,11 @@ namespace TEN::Renderer
 		return _meshes[meshIndex];
 	}
 
-	std::vector<BoundingSphere> Renderer::GetSpheres(int itemNumber)
+	unsigned int Renderer::GetItemAnimationRevision(int itemNumber)
 	{
 		auto& itemToDraw = _items[itemNumber];
 		itemToDraw.ItemNumber = itemNumber;
 
-		const auto* nativeItem = &g_Level.Items[itemNumber];
-		if (nativeItem == nullptr)
-			return {};
-
 		if (!itemToDraw.DoneAnimations)
 		{
 			if (itemNumber == LaraItem->Index)
@@ -434,6 +460,27 @@ namespace TEN::Renderer
 			}
 		}
 
+		return itemToDraw.AnimationRevision;
+	}
+
+	std::vector<BoundingSphere> Renderer::GetSpheres(int itemNumber)
+	{
+		auto spheres = std::vector<BoundingSphere>{};
+		GetSpheres(itemNumber, spheres);
+		return spheres;
+	}
+
+	void Renderer::GetSpheres(int itemNumber, std::vector<BoundingSphere>& spheres)
+	{
+		spheres.clear();
+
+		const auto* nativeItem = &g_Level.Items[itemNumber];
+		if (nativeItem == nullptr)
+			return;
+
+		GetItemAnimationRevision(itemNumber);
+		const auto& itemToDraw = _items[itemNumber];
+
 		auto translationMatrix = Matrix::CreateTranslation(nativeItem->Pose.Position.ToVector3());
 		auto rotMatrix = nativeItem->Pose.Orientation.ToRotationMatrix();
 		auto worldMatrix = rotMatrix * translationMatrix;
@@ -441,7 +488,7 @@ namespace TEN::Renderer
 		const auto& moveable = GetRendererObject(nativeItem->ObjectNumber);
 
 		// Collect spheres.
-		auto spheres = std::vector<BoundingSphere>{};
+		spheres.reserve(moveable.ObjectMeshes.size());
 		for (int i = 0; i < moveable.ObjectMeshes.size(); i++)
 		{
 			const auto& mesh = *moveable.ObjectMeshes[i];
@@ -452,8 +499,6 @@ namespace TEN::Renderer
 			auto sphere = BoundingSphere(pos, mesh.Sphere.Radius);
 			spheres.push_back(sphere);
 		}
-		
-		return spheres;
 	}
 
 	void Renderer::GetBoneMatrix(short itemNumber, int jointIndex, Matrix* outMatrix)
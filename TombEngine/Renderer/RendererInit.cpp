@@ -616,14 +616,17 @@ namespace TEN::Renderer
 		D3D_FEATURE_LEVEL featureLevel;
 		HRESULT res; 
 
+		// In headless mode, use software WARP device so that machines without GPU can still load levels.
+		auto driverType = HeadlessMode ? D3D_DRIVER_TYPE_WARP : D3D_DRIVER_TYPE_HARDWARE;
+
 		if constexpr (DebugBuild)
 		{
-			res = D3D11CreateDevice(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL, D3D11_CREATE_DEVICE_DEBUG,
+			res = D3D11CreateDevice(NULL, driverType, NULL, D3D11_CREATE_DEVICE_DEBUG,
 				levels, 1, D3D11_SDK_VERSION, &_device, &featureLevel, &_context);
 		}
 		else
 		{
-			res = D3D11CreateDevice(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL, NULL,
+			res = D3D11CreateDevice(NULL, driverType, NULL, NULL,
 				levels, 1, D3D11_SDK_VERSION, &_device, &featureLevel, &_context);
 		}
 
@@ -276,6 +276,7 @@ void Renderer::UpdateLaraAnimations(bool force)
 	// Copy meshswap indices.
 	rItem.MeshIndex = LaraItem->Model.MeshIndex;
 	rItem.DoneAnimations = true;
+	rItem.AnimationRevision++;
 }
 
 void TEN::Renderer::Renderer::DrawLara(RenderView& view, RendererPass rendererPass)
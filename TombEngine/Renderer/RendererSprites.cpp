@@ -1,4 +1,6 @@
 #include "framework.h"
+#include <chrono>
+
 #include "Renderer/Structures/RendererSprite.h"
 #include "Renderer/Structures/RendererSpriteBucket.h"
 #include "Renderer/Renderer.h"
@@ -194,30 +196,38 @@ namespace TEN::Renderer
 			return;
 		}
 
+		auto time1 = std::chrono::high_resolution_clock::now();
+
 		_spriteBuckets.clear();
 
-		// Sort sprites by sprite and blend mode for faster batching.
-		std::sort(
-			view.SpritesToDraw.begin(),
-			view.SpritesToDraw.end(),
-			[](RendererSpriteToDraw& rDrawSprite0, RendererSpriteToDraw& rDrawSprite1)
-			{
-				if (rDrawSprite0.Sprite != rDrawSprite1.Sprite)
-				{
-					return (rDrawSprite0.Sprite > rDrawSprite1.Sprite);
-				}
-				else if (rDrawSprite0.BlendMode != rDrawSprite1.BlendMode)
-				{
-					return (rDrawSprite0.BlendMode > rDrawSprite1.BlendMode);
-				}
-				else
-				{
-					return (rDrawSprite0.Type > rDrawSprite1.Type);
-				}
-			}
-		);
+		// Sort sprites by sprite, blend mode and bucket state for faster batching.
+		// Key packs sprite address into high bits, which leaves lowest 16 bits for state.
+		_sortKeys.resize(view.SpritesToDraw.size());
+		for (int i = 0; i < view.SpritesToDraw.size(); i++)
+		{
+			const auto& rDrawSprite = view.SpritesToDraw[i];
+
+			unsigned long long key = (unsigned long long)rDrawSprite.Sprite << 16;
+			key |= (unsigned long long)((int)rDrawSprite.BlendMode + 1) << 8;
+			key |= (unsigned long long)(rDrawSprite.Type != SpriteType::ThreeD) << 7;
+			key |= (unsigned long long)rDrawSprite.SoftParticle << 6;
+			key |= (unsigned long long)rDrawSprite.renderType;
 
-		// Group sprites to draw in buckets for instancing (billboards only).
+			_sortKeys[i] = Utils::SortKey{ key, i };
+		}
+
+		Utils::RadixSort(_sortKeys, _sortKeysBuffer);
+
+		_sortedSpritesToDraw.clear();
+		for (const auto& key : _sortKeys)
+			_sortedSpritesToDraw.push_back(view.SpritesToDraw[key.Index]);
+
+		std::swap(view.SpritesToDraw, _sortedSpritesToDraw);
+
+		auto time2 = std::chrono::high_resolution_clock::now();
+		_timeSort += (int)std::chrono::duration_cast<std::chrono::microseconds>(time2 - time1).count();
+
+		// Group sprites to draw in buckets for instancing (billboards only). Buckets are ranges of sorted sprites.
 		RendererSpriteBucket currentSpriteBucket;
 
 		currentSpriteBucket.Sprite = view.SpritesToDraw[0].Sprite;
@@ -226,15 +236,16 @@ namespace TEN::Renderer
 		currentSpriteBucket.IsSoftParticle = view.SpritesToDraw[0].SoftParticle;
 		currentSpriteBucket.RenderType = view.SpritesToDraw[0].renderType;
 
-		for (auto& rDrawSprite : view.SpritesToDraw)
+		for (int i = 0; i < view.SpritesToDraw.size(); i++)
 		{
+			auto& rDrawSprite = view.SpritesToDraw[i];
 			bool isBillboard = rDrawSprite.Type != SpriteType::ThreeD;
 
 			if (rDrawSprite.Sprite != currentSpriteBucket.Sprite ||
 				rDrawSprite.BlendMode != currentSpriteBucket.BlendMode ||
 				rDrawSprite.SoftParticle != currentSpriteBucket.IsSoftParticle ||
 				rDrawSprite.renderType != currentSpriteBucket.RenderType ||
-				currentSpriteBucket.SpritesToDraw.size() == INSTANCED_SPRITES_BUCKET_SIZE ||
+				currentSpriteBucket.SpriteCount == INSTANCED_SPRITES_BUCKET_SIZE ||
 				isBillboard != currentSpriteBucket.IsBillboard)
 			{
 				_spriteBuckets.push_back(currentSpriteBucket);
@@ -244,7 +255,8 @@ namespace TEN::Renderer
 				currentSpriteBucket.IsBillboard = isBillboard;
 				currentSpriteBucket.IsSoftParticle = rDrawSprite.SoftParticle;
 				currentSpriteBucket.RenderType = rDrawSprite.renderType;
-				currentSpriteBucket.SpritesToDraw.clear();
+				currentSpriteBucket.SpriteStart = i;
+				currentSpriteBucket.SpriteCount = 0;
 			}
 
 			if (rDrawSprite.BlendMode != BlendMode::Opaque &&
@@ -264,7 +276,8 @@ namespace TEN::Renderer
 			}
 			else
 			{
-				currentSpriteBucket.SpritesToDraw.push_back(rDrawSprite);
+				// NOTE: Blend mode is part of bucket state, so instanced sprites of bucket are always contiguous.
+				currentSpriteBucket.SpriteCount++;
 			}
 		}
 
@@ -283,7 +296,7 @@ namespace TEN::Renderer
 
 		for (auto& spriteBucket : _spriteBuckets)
 		{
-			if (spriteBucket.SpritesToDraw.size() == 0 || !spriteBucket.IsBillboard)
+			if (spriteBucket.SpriteCount == 0 || !spriteBucket.IsBillboard)
 			{
 				continue;
 			}
@@ -314,9 +327,9 @@ namespace TEN::Renderer
 			}
 
 			// Prepare constant buffer for instanced sprites.
-			for (int i = 0; i < spriteBucket.SpritesToDraw.size(); i++)
+			for (int i = 0; i < spriteBucket.SpriteCount; i++)
 			{
-				auto& rDrawSprite = spriteBucket.SpritesToDraw[i];
+				auto& rDrawSprite = view.SpritesToDraw[spriteBucket.SpriteStart + i];
 
 				_stInstancedSpriteBuffer.Sprites[i].World = GetWorldMatrixForSprite(&rDrawSprite, view);
 				_stInstancedSpriteBuffer.Sprites[i].Color = rDrawSprite.color;
@@ -339,7 +352,7 @@ namespace TEN::Renderer
 			_cbInstancedSpriteBuffer.UpdateData(_stInstancedSpriteBuffer, _context.Get());
 
 			// Draw sprites with instancing.
-			DrawInstancedTriangles(4, (unsigned int)spriteBucket.SpritesToDraw.size(), 0);
+			DrawInstancedTriangles(4, (unsigned int)spriteBucket.SpriteCount, 0);
 
 			_numInstancedSpritesDrawCalls++;
 		}
@@ -349,7 +362,7 @@ namespace TEN::Renderer
 
 		for (auto& spriteBucket : _spriteBuckets)
 		{
-			if (spriteBucket.SpritesToDraw.empty() || spriteBucket.IsBillboard)
+			if (spriteBucket.SpriteCount == 0 || spriteBucket.IsBillboard)
 			{
 				continue;
 			}
@@ -382,8 +395,10 @@ namespace TEN::Renderer
 
 			_primitiveBatch->Begin();
 
-			for (auto& rDrawSprite : spriteBucket.SpritesToDraw)
+			for (int i = 0; i < spriteBucket.SpriteCount; i++)
 			{
+				auto& rDrawSprite = view.SpritesToDraw[spriteBucket.SpriteStart + i];
+
 				auto vertex0 = Vertex{};
 				vertex0.Position = rDrawSprite.vtx1;
 				vertex0.UV = rDrawSprite.Sprite->UV[0];
@@ -1,6 +1,8 @@
 #include "framework.h"
 #include "Renderer/Renderer.h"
 
+#include <chrono>
+
 #include "Specific/trutils.h"
 #include "Specific/winmain.h"
 
@@ -36,6 +38,8 @@ namespace TEN::Renderer
 		if (string.empty())
 			return;
 
+		auto time1 = std::chrono::high_resolution_clock::now();
+
 		try
 		{
 			auto screenRes = GetScreenResolution();
@@ -44,21 +48,20 @@ namespace TEN::Renderer
 			float fontSpacing = _gameFont->GetLineSpacing();
 			float fontScale = REFERENCE_FONT_SIZE / fontSpacing;
 
-			auto stringLines = SplitString(string);
+			const auto& layout = GetStringLayout(string);
 			float yOffset = 0.0f;
-			for (const auto& line : stringLines)
+			for (const auto& line : layout.Lines)
 			{
 				// Prepare structure for renderer.
 				RendererStringToDraw rString;
-				rString.String = TEN::Utils::ToWString(line);
+				rString.String = line.String;
 				rString.Flags = flags;
 				rString.X = 0;
 				rString.Y = 0;
 				rString.Color = color.ToVector3();
 				rString.Scale = (uiScale * fontScale) * scale;
 
-				// Measure string.
-				auto size = Vector2(_gameFont->MeasureString(rString.String.c_str())) * rString.Scale;
+				auto size = line.Size * rString.Scale;
 				if (flags & (int)PrintStringFlags::Center)
 				{
 					rString.X = (pos.x * factor.x) - (size.x / 2.0f);
@@ -70,7 +73,7 @@ namespace TEN::Renderer
 				else
 				{
 					// Calculate indentation to account for string scaling.
-					auto indent = _gameFont->FindGlyph(line.at(0))->XAdvance * rString.Scale;
+					auto indent = line.Indent * rString.Scale;
 					rString.X = pos.x * factor.x + indent;
 				}
 
@@ -102,6 +105,34 @@ namespace TEN::Renderer
 		{
 			TENLog(std::string("Unable to process string: '") + string + "'. Exception: " + std::string(ex.what()), LogLevel::Error);
 		}
+
+		auto time2 = std::chrono::high_resolution_clock::now();
+		_timeStringsAccumulator += (int)std::chrono::duration_cast<std::chrono::microseconds>(time2 - time1).count();
+	}
+
+	// Splitting, conversion and measurement only depend on string contents, so they are done once per distinct string.
+	// Translated strings are resolved before they get here, so language changes produce new entries instead of stale ones.
+	const RendererStringLayout& Renderer::GetStringLayout(const std::string& string)
+	{
+		auto it = _stringLayoutCache.find(string);
+		if (it != _stringLayoutCache.end())
+			return it->second;
+
+		// Strings with changing contents (e.g. timers) would grow cache indefinitely, so it is periodically flushed.
+		if (_stringLayoutCache.size() >= STRING_LAYOUT_CACHE_SIZE_MAX)
+			_stringLayoutCache.clear();
+
+		auto layout = RendererStringLayout{};
+		for (const auto& line : SplitString(string))
+		{
+			auto layoutLine = RendererStringLayoutLine{};
+			layoutLine.String = TEN::Utils::ToWString(line);
+			layoutLine.Size = Vector2(_gameFont->MeasureString(layoutLine.String.c_str()));
+			layoutLine.Indent = line.empty() ? 0.0f : _gameFont->FindGlyph(line.at(0))->XAdvance;
+			layout.Lines.push_back(layoutLine);
+		}
+
+		return _stringLayoutCache.emplace(string, std::move(layout)).first->second;
 	}
 
 	void Renderer::DrawAllStrings()
@@ -134,5 +165,8 @@ namespace TEN::Renderer
 
 		_isBlinkUpdated = false;
 		_stringsToDraw.clear();
+
+		_timeStrings = _timeStringsAccumulator;
+		_timeStringsAccumulator = 0;
 	}
 }
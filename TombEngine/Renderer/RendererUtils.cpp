@@ -159,4 +159,43 @@ namespace TEN::Renderer::Utils
 		
 		return flags;
 	}
+
+	// Stable LSD radix sort by ascending key, one byte per pass. Passes where all keys share same byte are skipped.
+	void RadixSort(std::vector<SortKey>& keys, std::vector<SortKey>& buffer)
+	{
+		constexpr auto PASS_COUNT	= sizeof(unsigned long long);
+		constexpr auto BUCKET_COUNT = 256;
+
+		if (keys.size() < 2)
+			return;
+
+		unsigned int counts[PASS_COUNT][BUCKET_COUNT] = {};
+		for (const auto& key : keys)
+		{
+			for (int pass = 0; pass < PASS_COUNT; pass++)
+				counts[pass][(key.Key >> (pass * 8)) & 0xFF]++;
+		}
+
+		buffer.resize(keys.size());
+
+		for (int pass = 0; pass < PASS_COUNT; pass++)
+		{
+			auto& passCounts = counts[pass];
+			if (passCounts[(keys.front().Key >> (pass * 8)) & 0xFF] == keys.size())
+				continue;
+
+			unsigned int offset = 0;
+			for (auto& count : passCounts)
+			{
+				unsigned int bucketSize = count;
+				count = offset;
+				offset += bucketSize;
+			}
+
+			for (const auto& key : keys)
+				buffer[passCounts[(key.Key >> (pass * 8)) & 0xFF]++] = key;
+
+			std::swap(keys, buffer);
+		}
+	}
 }
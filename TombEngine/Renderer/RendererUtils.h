@@ -1,11 +1,18 @@
 #pragma once
 #include <string>
+#include <vector>
 #include <winerror.h>
 #include <wrl/client.h>
 #include <d3d11.h>
 
 namespace TEN::Renderer::Utils
 {
+	struct SortKey
+	{
+		unsigned long long Key	 = 0;
+		int				   Index = 0;
+	};
+
 	void throwIfFailed(const HRESULT& res);
 	void throwIfFailed(const HRESULT& res, const std::string& info);
 	void throwIfFailed(const HRESULT& res, const std::wstring& info);
@@ -13,5 +20,7 @@ namespace TEN::Renderer::Utils
 	[[nodiscard]] Microsoft::WRL::ComPtr<ID3D11VertexShader> compileVertexShader(ID3D11Device* device, const std::wstring& fileName, const std::string& function, const std::string& model, const D3D_SHADER_MACRO* defines, Microsoft::WRL::ComPtr<ID3D10Blob>& bytecode);
 	constexpr [[nodiscard]] unsigned int GetShaderFlags();
 	[[nodiscard]] Microsoft::WRL::ComPtr<ID3D11PixelShader> compilePixelShader(ID3D11Device* device, const std::wstring& fileName, const std::string& function, const std::string& model, const D3D_SHADER_MACRO* defines, Microsoft::WRL::ComPtr<ID3D10Blob>& bytecode);
+	void RadixSort(std::vector<SortKey>& keys, std::vector<SortKey>& buffer);
+
 	[[nodiscard]] Microsoft::WRL::ComPtr<ID3D11ComputeShader> compileComputeShader(ID3D11Device* device, const std::wstring& fileName, const std::string& function, const std::string& model, const D3D_SHADER_MACRO* defines, Microsoft::WRL::ComPtr<ID3D10Blob>& bytecode);
 }
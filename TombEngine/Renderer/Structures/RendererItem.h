@@ -30,5 +30,6 @@ namespace TEN::Renderer::Structures
 		std::vector<int> MeshIndex;
 
 		bool DoneAnimations;
+		unsigned int AnimationRevision = 0; // Incremented whenever animation transforms are recalculated.
 	};
 }
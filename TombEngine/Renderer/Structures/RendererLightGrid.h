@@ -0,0 +1,28 @@
+#pragma once
+#include <vector>
+#include "Renderer/Structures/RendererLight.h"
+
+namespace TEN::Renderer::Structures
+{
+	struct RendererLightGridNode
+	{
+		RendererLight* Light;
+		int RoomNumber;
+	};
+
+	// Uniform grid over level XZ plane. Each cell lists point, shadow and spot lights which may reach positions inside it.
+	struct RendererLightGrid
+	{
+		bool IsRoomLightsBuilt = false;
+
+		int OriginX = 0;
+		int OriginZ = 0;
+		int Width	= 0;
+		int Depth	= 0;
+
+		std::vector<std::vector<RendererLightGridNode>> RoomLightCells	  = {}; // Built once per level and after room flips.
+		std::vector<std::vector<RendererLight*>>		DynamicLightCells = {}; // Rebuilt every frame.
+		std::vector<int>								UsedDynamicCells  = {};
+		std::vector<std::vector<RendererLight*>>		RoomSunLights	  = {};
+	};
+}
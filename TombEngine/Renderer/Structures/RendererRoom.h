@@ -9,6 +9,7 @@
 #include "Renderer/Structures/RendererEffect.h"
 #include "Renderer/Structures/RendererStatic.h"
 #include "Renderer/Structures/RendererDoor.h"
+#include "Renderer/Structures/RendererRoomNode.h"
 
 namespace TEN::Renderer::Structures
 {
@@ -16,6 +17,12 @@ namespace TEN::Renderer::Structures
 	using namespace DirectX::SimpleMath;
 	using namespace TEN::Renderer::Graphics;
 
+	struct RendererRoomEntry
+	{
+		short FromRoomNumber;
+		Vector4 ViewPort;
+	};
+
 	struct RendererRoom
 	{
 		bool Visited;
@@ -30,6 +37,7 @@ namespace TEN::Renderer::Structures
 		std::vector<RendererStatic*> StaticsToDraw;
 		std::vector<RendererLight*> LightsToDraw;
 		std::vector<RendererDoor> Doors;
+		std::vector<RendererRoomEntry> Entries; // Portal view ports room was entered with in current frame.
 		BoundingBox BoundingBox;
 		RendererRectangle ClipBounds;
 		std::vector<int> Neighbors;
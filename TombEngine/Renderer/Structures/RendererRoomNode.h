@@ -7,8 +7,10 @@ namespace TEN::Renderer::Structures
 
 	struct RendererRoomNode
 	{
-		short From;
-		short To;
-		Vector4 ClipPort;
+		short FromRoomNumber;
+		short RoomNumber;
+		Vector4 ViewPort;
+		int Depth;
+		int ParentNodeIndex;
 	};
 }
\ No newline at end of file
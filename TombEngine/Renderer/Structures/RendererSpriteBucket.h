@@ -9,7 +9,8 @@ namespace TEN::Renderer::Structures
 	{
 		RendererSprite* Sprite;
 		BlendMode BlendMode;
-		std::vector<RendererSpriteToDraw> SpritesToDraw;
+		int SpriteStart = 0; // Range of view SpritesToDraw, which is sorted by bucket.
+		int SpriteCount = 0;
 
 		bool IsBillboard = false;
 		bool IsSoftParticle = false;
@@ -14,4 +14,17 @@ namespace TEN::Renderer::Structures
 		Vector3 Color;
 		float Scale;
 	};
+
+	// Split and measured string lines. Sizes are unscaled, so same layout can be used at any scale and resolution.
+	struct RendererStringLayoutLine
+	{
+		std::wstring String;
+		Vector2 Size;
+		float Indent;
+	};
+
+	struct RendererStringLayout
+	{
+		std::vector<RendererStringLayoutLine> Lines;
+	};
 }
@@ -367,14 +367,15 @@ void FlowHandler::LoadFlowScript()
 
 char const * FlowHandler::GetString(const char* id) const
 {
-	if (!ScriptAssert(_translationMap.find(id) != _translationMap.end(), std::string{ "Couldn't find string " } + id))
+	// NOTE: Called every frame for each translated display string, so error message is only built on failure.
+	auto it = _translationMap.find(id);
+	if (it == _translationMap.end())
 	{
+		ScriptAssert(false, std::string{ "Couldn't find string " } + id);
 		return id;
 	}
-	else
-	{
-		return _translationMap.at(std::string(id)).at(0).c_str();
-	}
+
+	return it->second.at(0).c_str();
 }
 
 bool FlowHandler::IsStringPresent(const char* id) const
@@ -10,6 +10,8 @@
 #include "Game/Lara/lara_helpers.h"
 #include "Game/Setup.h"
 #include "Math/Math.h"
+#include "Objects/Generic/Object/Pushable/PushableInfo.h"
+#include "Objects/Generic/Object/Pushable/PushableStack.h"
 #include "Objects/objectslist.h"
 #include "Scripting/Internal/ReservedScriptNames.h"
 #include "Scripting/Internal/ScriptAssert.h"
@@ -23,6 +25,7 @@
 
 using namespace TEN::Collision::Floordata;
 using namespace TEN::Effects::Items;
+using namespace TEN::Entities::Generic;
 using namespace TEN::Math;
 
 /***
@@ -482,6 +485,7 @@ void Moveable::SetObjectID(GAME_OBJECT_ID id)
 {
 	m_item->ObjectNumber = id;
 	m_item->ResetModelToDefault();
+	UpdateItemObjectIndex(m_num);
 }
 
 void SetLevelFuncCallback(const TypeOrNil<LevelFunc>& cb, const std::string& callerName, Moveable& mov, std::string& toModify)
@@ -601,6 +605,9 @@ void Moveable::SetPos(const Vec3& pos, sol::optional<bool> updateRoom)
 
 	if (m_item->IsBridge())
 		UpdateBridgeItem(*m_item);
+
+	if (m_item->Data.is<PushableInfo>())
+		UpdatePushableStackIndex(m_item->Index);
 }
 
 Vec3 Moveable::GetJointPos(int jointIndex) const
@@ -248,3 +248,78 @@ bool ObjectsHandler::RemoveMoveableFromMap(ItemInfo* key, Moveable* mov)
 
 	return false;
 }
+
+bool ObjectsHandler::AddName(const std::string& key, VarMapVal val)
+{
+	if (key.empty())
+		return false;
+
+	auto p = std::pair< const std::string&, VarMapVal>{ key, val };
+	if (!m_nameMap.insert(p).second)
+		return false;
+
+	IndexName(key, val);
+	return true;
+}
+
+bool ObjectsHandler::RemoveName(const std::string& key)
+{
+	auto it = m_nameMap.find(key);
+	if (it == m_nameMap.end())
+		return false;
+
+	UnindexName(key, it->second);
+	m_nameMap.erase(it);
+	return true;
+}
+
+void ObjectsHandler::FreeEntities()
+{
+	m_nameMap.clear();
+	m_staticNamesBySlot.clear();
+	m_roomNamesByTag.clear();
+}
+
+void ObjectsHandler::IndexName(const std::string& key, const VarMapVal& val)
+{
+	if (std::holds_alternative<std::reference_wrapper<MESH_INFO>>(val))
+	{
+		const auto& mesh = std::get<std::reference_wrapper<MESH_INFO>>(val).get();
+		m_staticNamesBySlot[mesh.staticNumber].push_back(key);
+	}
+	else if (std::holds_alternative<std::reference_wrapper<ROOM_INFO>>(val))
+	{
+		const auto& room = std::get<std::reference_wrapper<ROOM_INFO>>(val).get();
+		for (const auto& tag : room.Tags)
+			m_roomNamesByTag[tag].push_back(key);
+	}
+}
+
+void ObjectsHandler::UnindexName(const std::string& key, const VarMapVal& val)
+{
+	auto eraseName = [&key](std::vector<std::string>& names)
+	{
+		auto it = std::find(names.begin(), names.end(), key);
+		if (it != names.end())
+			names.erase(it);
+	};
+
+	if (std::holds_alternative<std::reference_wrapper<MESH_INFO>>(val))
+	{
+		const auto& mesh = std::get<std::reference_wrapper<MESH_INFO>>(val).get();
+
+		auto it = m_staticNamesBySlot.find(mesh.staticNumber);
+		if (it != m_staticNamesBySlot.end())
+			eraseName(it->second);
+	}
+	else if (std::holds_alternative<std::reference_wrapper<ROOM_INFO>>(val))
+	{
+		const auto& room = std::get<std::reference_wrapper<ROOM_INFO>>(val).get();
+		for (const auto& tag : room.Tags)
+		{
+			auto it = m_roomNamesByTag.find(tag);
+			if (it != m_roomNamesByTag.end())
+				eraseName(it->second);
+		}
+	}
+}
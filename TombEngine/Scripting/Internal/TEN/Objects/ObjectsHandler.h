@@ -47,6 +47,9 @@ private:
 	std::unordered_map<ItemInfo *, std::unordered_set<Moveable*>>	moveables{};
 	std::unordered_map<std::string, VarMapVal>						m_nameMap{};
 	std::unordered_map<std::string, short>	 						m_itemsMapName{};
+	// Secondary indices of named statics by slot and named rooms by tag, kept in sync with m_nameMap.
+	std::unordered_map<int, std::vector<std::string>>				m_staticNamesBySlot{};
+	std::unordered_map<std::string, std::vector<std::string>>		m_roomNamesByTag{};
 	// A set of items that are visible, collidable, and have Lua OnCollide callbacks.
 	std::unordered_set<short>		 								m_collidingItems{};
 	std::unordered_set<short>		 								m_collidingItemsToRemove{};
@@ -68,15 +71,17 @@ private:
 	std::vector <std::unique_ptr<R>> GetMoveablesBySlot(GAME_OBJECT_ID objID)
 	{
 		std::vector<std::unique_ptr<R>> items = {};
-		for (auto& [key, val] : m_nameMap)
+		for (int itemNumber : GetItemNumbersByObjectID(objID))
 		{
-			if (!std::holds_alternative<short>(val))
+			const auto& item = g_Level.Items[itemNumber];
+			if (item.Name.empty())
 				continue;
 
-			auto& item = g_Level.Items[GetIndexByName(key)];
+			auto it = m_nameMap.find(item.Name);
+			if (it == m_nameMap.end() || !std::holds_alternative<short>(it->second) || std::get<short>(it->second) != itemNumber)
+				continue;
 
-			if (objID == item.ObjectNumber)
-				items.push_back(GetByName<Moveable, ScriptReserved_Moveable>(key));
+			items.push_back(std::make_unique<R>(itemNumber));
 		}
 
 		return items;
@@ -86,16 +91,13 @@ private:
 	std::vector <std::unique_ptr<R>> GetStaticsBySlot(int slot)
 	{
 		std::vector<std::unique_ptr<R>> items = {};
-		for (auto& [key, val] : m_nameMap)
-		{
-			if (!std::holds_alternative<std::reference_wrapper<MESH_INFO>>(val))
-				continue;
-			
-			auto meshInfo = std::get<std::reference_wrapper<MESH_INFO>>(val).get();
 
-			if (meshInfo.staticNumber == slot)
-				items.push_back(GetByName<Static, ScriptReserved_Static>(key));
-		}
+		auto it = m_staticNamesBySlot.find(slot);
+		if (it == m_staticNamesBySlot.end())
+			return items;
+
+		for (const auto& name : it->second)
+			items.push_back(GetByName<Static, ScriptReserved_Static>(name));
 
 		return items;
 	}
@@ -104,19 +106,13 @@ private:
 	std::vector <std::unique_ptr<R>> GetRoomsByTag(std::string tag)
 	{
 		std::vector<std::unique_ptr<R>> rooms = {};
-		for (auto& [key, val] : m_nameMap)
-		{
-			if (!std::holds_alternative<std::reference_wrapper<ROOM_INFO>>(val))
-				continue;
 
-			auto room = std::get<std::reference_wrapper<ROOM_INFO>>(val).get();
-			
-			if (std::any_of(room.Tags.begin(), room.Tags.end(),
-				[&tag](const std::string& value) { return value == tag; }))
-			{
-				rooms.push_back(GetByName<Room, ScriptReserved_Room>(key));
-			}
-		}
+		auto it = m_roomNamesByTag.find(tag);
+		if (it == m_roomNamesByTag.end())
+			return rooms;
+
+		for (const auto& name : it->second)
+			rooms.push_back(GetByName<Room, ScriptReserved_Room>(name));
 
 		return rooms;
 	}
@@ -126,22 +122,10 @@ private:
 		return std::get<short>(m_nameMap.at(name));
 	}
 
-	bool AddName(const std::string& key, VarMapVal val) override
-	{
-		if (key.empty())
-			return false;
+	bool AddName(const std::string& key, VarMapVal val) override;
+	bool RemoveName(const std::string& key);
+	void FreeEntities() override;
 
-		auto p = std::pair< const std::string&, VarMapVal>{ key, val };
-		return m_nameMap.insert(p).second;
-	}
-
-	bool RemoveName(const std::string& key)
-	{
-		return m_nameMap.erase(key);
-	}
-
-	void FreeEntities() override
-	{
-		m_nameMap.clear();
-	}
+	void IndexName(const std::string& key, const VarMapVal& val);
+	void UnindexName(const std::string& key, const VarMapVal& val);
 };
@@ -246,8 +246,14 @@ int Static::GetSlot() const
 
 void Static::SetSlot(int slot)
 {
+	// Re-register name so that it is moved to new slot in lookup index.
+	bool isNamed = !m_mesh.Name.empty() && s_callbackRemoveName(m_mesh.Name);
+
 	m_mesh.staticNumber = slot;
 	m_mesh.Dirty = true;
+
+	if (isNamed)
+		s_callbackSetName(m_mesh.Name, m_mesh);
 }
 
 ScriptColor Static::GetColor() const
@@ -16,6 +16,8 @@
 #include "Renderer/Renderer.h"
 #include "Sound/sound.h"
 #include "Specific/clock.h"
+#include "Specific/Input/InputRecording.h"
+#include "Specific/Input/InputSampler.h"
 #include "Specific/trutils.h"
 #include "Specific/winmain.h"
 
@@ -125,6 +127,28 @@ namespace TEN::Input
 
 	auto ConflictingKeys = std::array<bool, (int)In::Count>{};
 
+	// Captures keyboard on sampler thread. While sampler is active, keyboard is not captured on game thread.
+	class OisKeyboardSampleBackend : public InputSampleBackend
+	{
+	public:
+		bool Capture(std::array<bool, MAX_KEYBOARD_KEYS>& keys) override
+		{
+			try
+			{
+				OisKeyboard->capture();
+			}
+			catch (OIS::Exception&)
+			{
+				return false;
+			}
+
+			for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+				keys[i] = OisKeyboard->isKeyDown((KeyCode)i);
+
+			return true;
+		}
+	};
+
 	void InitializeEffect()
 	{
 		OisEffect = new Effect(Effect::ConstantForce, Effect::Constant);
@@ -158,6 +182,11 @@ namespace TEN::Input
 		AxisMap.resize((int)InputAxis::Count);
 
 		RumbleInfo = {};
+		DefaultConflict();
+
+		// Headless mode has no input devices.
+		if (HeadlessMode)
+			return;
 
 		try
 		{
@@ -197,6 +226,9 @@ namespace TEN::Input
 			TENLog("An exception occured during input system init: " + std::string(ex.eText), LogLevel::Error);
 		}
 
+		if (OisKeyboard != nullptr)
+			StartInputSampler(std::make_unique<OisKeyboardSampleBackend>());
+
 		int deviceCount = OisInputManager->getNumberOfDevices(OISJoyStick);
 		if (deviceCount > 0)
 		{
@@ -232,6 +264,11 @@ namespace TEN::Input
 
 	void DeinitializeInput()
 	{
+		StopInputSampler();
+
+		if (OisInputManager == nullptr)
+			return;
+
 		if (OisKeyboard != nullptr)
 			OisInputManager->destroyInputObject(OisKeyboard);
 
@@ -362,29 +399,43 @@ namespace TEN::Input
 
 	static void ReadKeyboard()
 	{
-		if (OisKeyboard == nullptr)
-			return;
+		auto keys = std::array<bool, MAX_KEYBOARD_KEYS>{};
 
-		try
+		if (IsInputSamplerActive())
 		{
-			OisKeyboard->capture();
+			// Collect keys sampled since previous update, including presses which were already released.
+			ConsumeInputEvents(keys);
+		}
+		else
+		{
+			if (OisKeyboard == nullptr)
+				return;
 
-			// Poll keys.
-			for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+			try
 			{
-				if (!OisKeyboard->isKeyDown((KeyCode)i))
-					continue;
-
-				int key = WrapSimilarKeys(i);
-				KeyMap[key] = true;
+				OisKeyboard->capture();
 
-				// Interpret discrete directional keypresses as analog axis values.
-				SetDiscreteAxisValues(key);
+				for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+					keys[i] = OisKeyboard->isKeyDown((KeyCode)i);
+			}
+			catch (OIS::Exception& ex)
+			{
+				TENLog("Unable to poll keyboard input: " + std::string(ex.eText), LogLevel::Warning);
+				return;
 			}
 		}
-		catch (OIS::Exception& ex)
+
+		// Poll keys.
+		for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
 		{
-			TENLog("Unable to poll keyboard input: " + std::string(ex.eText), LogLevel::Warning);
+			if (!keys[i])
+				continue;
+
+			int key = WrapSimilarKeys(i);
+			KeyMap[key] = true;
+
+			// Interpret discrete directional keypresses as analog axis values.
+			SetDiscreteAxisValues(key);
 		}
 	}
 
@@ -711,11 +762,22 @@ namespace TEN::Input
 		ReadKeyboard();
 		ReadMouse();
 		ReadGameController();
-		DefaultConflict();
+
+		// Collect action states.
+		static_assert((int)ActionID::Count <= 64, "Action mask too small.");
+		unsigned long long actionMask = 0;
+		for (const auto& action : ActionMap)
+		{
+			if (Key((int)action.GetID()))
+				actionMask |= 1ull << (int)action.GetID();
+		}
+
+		// Record or replay action states, including menu polls. NOTE: Queue is applied only on gameplay ticks.
+		UpdateInputRecording(actionMask, AxisMap, applyQueue);
 
 		// Update action map.
 		for (auto& action : ActionMap)
-			action.Update(Key((int)action.GetID()));
+			action.Update(((actionMask >> (int)action.GetID()) & 1) != 0);
 
 		if (applyQueue)
 			ApplyActionQueue();
@@ -775,6 +837,8 @@ namespace TEN::Input
 
 			Bindings[1][i] = bindings[i];
 		}
+
+		DefaultConflict();
 	}
 
 	void ApplyDefaultBindings()
@@ -815,6 +879,9 @@ namespace TEN::Input
 
 	Vector2 GetMouse2DPosition()
 	{
+		if (OisMouse == nullptr)
+			return Vector2::Zero;
+
 		const auto& state = OisMouse->getMouseState();
 
 		auto areaRes = Vector2(state.width, state.height);
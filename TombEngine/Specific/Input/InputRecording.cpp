@@ -0,0 +1,259 @@
+#include "framework.h"
+#include "Specific/Input/InputRecording.h"
+
+#include <fstream>
+#include <random>
+
+#include "Game/items.h"
+#include "Math/Random.h"
+#include "Specific/Input/Input.h"
+#include "Specific/level.h"
+
+using namespace TEN::Math;
+
+// Input recordings store action states and axes of every input poll together with the random seed,
+// so that a play session can be rerun frame-exactly across builds. Polls made by inventory and pause menus
+// are recorded as well, so that item use, pause and save or load menus are replayed.
+// File layout:
+//	Header: magic, version, random seed, desync check interval.
+//	Per poll: poll type (u8, 1 for gameplay tick, 0 for menu), action mask (u64), axis mask (u8), one Vector2 per set axis bit.
+//	Every DESYNC_CHECK_INTERVAL gameplay ticks: pose hash (u32) of all active items, taken before the tick is processed.
+// Desync stops replay and makes engine exit with failure code.
+
+namespace TEN::Input
+{
+	constexpr auto RECORDING_MAGIC		   = 0x524E4554; // "TENR"
+	constexpr auto RECORDING_VERSION	   = 3;
+	constexpr auto DESYNC_CHECK_INTERVAL   = 30;
+
+	struct InputRecordingHeader
+	{
+		unsigned int Magic				 = RECORDING_MAGIC;
+		unsigned int Version			 = RECORDING_VERSION;
+		unsigned int Seed				 = 0;
+		unsigned int DesyncCheckInterval = DESYNC_CHECK_INTERVAL;
+	};
+
+	static auto RecordingMode	  = InputRecordingMode::None;
+	static auto RecordingPath	  = std::string();
+	static auto RecordingFile	  = std::fstream();
+	static auto RecordingHeader	  = InputRecordingHeader{};
+	static bool IsRecordingActive = false;
+	static bool IsReplayFinished  = false;
+	static bool IsReplayDesynced  = false;
+	static int	RecordingTick	  = 0;
+
+	template <typename T>
+	static void Write(const T& value)
+	{
+		RecordingFile.write((const char*)&value, sizeof(T));
+	}
+
+	template <typename T>
+	static bool Read(T& value)
+	{
+		RecordingFile.read((char*)&value, sizeof(T));
+		return (RecordingFile.gcount() == sizeof(T));
+	}
+
+	static unsigned int GetItemPoseHash()
+	{
+		constexpr auto FNV_OFFSET_BASIS = 2166136261u;
+		constexpr auto FNV_PRIME		= 16777619u;
+
+		unsigned int hash = FNV_OFFSET_BASIS;
+		auto hashValue = [&hash](int value)
+		{
+			for (int i = 0; i < sizeof(int); i++)
+			{
+				hash ^= (value >> (i * 8)) & 0xFF;
+				hash *= FNV_PRIME;
+			}
+		};
+
+		for (const auto& item : g_Level.Items)
+		{
+			if (!item.Active && !item.IsLara())
+				continue;
+
+			hashValue(item.Index);
+			hashValue(item.Pose.Position.x);
+			hashValue(item.Pose.Position.y);
+			hashValue(item.Pose.Position.z);
+			hashValue(item.Pose.Orientation.x);
+			hashValue(item.Pose.Orientation.y);
+			hashValue(item.Pose.Orientation.z);
+			hashValue(item.RoomNumber);
+			hashValue(item.Animation.AnimNumber);
+			hashValue(item.Animation.FrameNumber);
+		}
+
+		return hash;
+	}
+
+	void InitializeInputRecording(InputRecordingMode mode, const std::string& path)
+	{
+		RecordingMode = mode;
+		RecordingPath = path;
+	}
+
+	void StartInputRecording()
+	{
+		if (RecordingMode == InputRecordingMode::None || IsRecordingActive)
+			return;
+
+		RecordingTick = 0;
+		IsReplayFinished = false;
+		IsReplayDesynced = false;
+
+		if (RecordingMode == InputRecordingMode::Record)
+		{
+			RecordingFile.open(RecordingPath, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!RecordingFile.is_open())
+			{
+				TENLog("Unable to create input recording " + RecordingPath + ".", LogLevel::Error);
+				RecordingMode = InputRecordingMode::None;
+				return;
+			}
+
+			RecordingHeader = InputRecordingHeader{};
+			RecordingHeader.Seed = std::random_device{}();
+			Write(RecordingHeader);
+
+			TENLog("Recording input to " + RecordingPath + ".", LogLevel::Info);
+		}
+		else
+		{
+			RecordingFile.open(RecordingPath, std::ios::in | std::ios::binary);
+			if (!RecordingFile.is_open() || !Read(RecordingHeader) ||
+				RecordingHeader.Magic != RECORDING_MAGIC || RecordingHeader.Version != RECORDING_VERSION)
+			{
+				TENLog("Unable to read input recording " + RecordingPath + ".", LogLevel::Error);
+				RecordingFile.close();
+				RecordingMode = InputRecordingMode::None;
+				return;
+			}
+
+			TENLog("Replaying input from " + RecordingPath + ".", LogLevel::Info);
+		}
+
+		Random::SetSeed(RecordingHeader.Seed);
+		IsRecordingActive = true;
+	}
+
+	void StopInputRecording()
+	{
+		if (!IsRecordingActive)
+			return;
+
+		RecordingFile.close();
+		IsRecordingActive = false;
+
+		// Only first played level is recorded or replayed.
+		RecordingMode = InputRecordingMode::None;
+		TENLog("Input recording stopped after " + std::to_string(RecordingTick) + " ticks.", LogLevel::Info);
+	}
+
+	bool IsInputReplayFinished()
+	{
+		return IsReplayFinished;
+	}
+
+	bool IsInputReplayDesynced()
+	{
+		return IsReplayDesynced;
+	}
+
+	static void RecordFrame(unsigned long long actionMask, const std::vector<Vector2>& axes, bool isGameTick)
+	{
+		unsigned char axisMask = 0;
+		for (int i = 0; i < axes.size(); i++)
+		{
+			if (axes[i] != Vector2::Zero)
+				axisMask |= 1 << i;
+		}
+
+		Write((unsigned char)isGameTick);
+		Write(actionMask);
+		Write(axisMask);
+		for (int i = 0; i < axes.size(); i++)
+		{
+			if (axisMask & (1 << i))
+				Write(axes[i]);
+		}
+
+		if (isGameTick && (RecordingTick % RecordingHeader.DesyncCheckInterval) == 0)
+			Write(GetItemPoseHash());
+	}
+
+	static void ReplayFrame(unsigned long long& actionMask, std::vector<Vector2>& axes, bool isGameTick)
+	{
+		unsigned char pollType = 0;
+		unsigned char axisMask = 0;
+		if (!Read(pollType) || !Read(actionMask) || !Read(axisMask))
+		{
+			TENLog("Input replay finished after " + std::to_string(RecordingTick) + " ticks.", LogLevel::Info);
+
+			actionMask = 0;
+			IsReplayFinished = true;
+			StopInputRecording();
+			return;
+		}
+
+		for (int i = 0; i < axes.size(); i++)
+		{
+			axes[i] = Vector2::Zero;
+			if (axisMask & (1 << i))
+				Read(axes[i]);
+		}
+
+		// Menu opened or closed at different poll than in recording.
+		if (pollType != (unsigned char)isGameTick)
+		{
+			TENLog("Input replay desync detected at tick " + std::to_string(RecordingTick) + " (menu poll mismatch).", LogLevel::Error);
+
+			actionMask = 0;
+			IsReplayDesynced = true;
+			IsReplayFinished = true;
+			StopInputRecording();
+			return;
+		}
+
+		if (isGameTick && (RecordingTick % RecordingHeader.DesyncCheckInterval) == 0)
+		{
+			unsigned int recordedHash = 0;
+			Read(recordedHash);
+
+			unsigned int hash = GetItemPoseHash();
+			if (hash != recordedHash)
+			{
+				TENLog("Input replay desync detected at tick " + std::to_string(RecordingTick) + ".", LogLevel::Error);
+
+				actionMask = 0;
+				IsReplayDesynced = true;
+				IsReplayFinished = true;
+				StopInputRecording();
+			}
+		}
+	}
+
+	// Called on every input poll with action states read from devices. During replay, they are replaced by recorded ones.
+	// Menu polls are not gameplay ticks; they are replayed in order, but don't advance tick counter or check desync.
+	void UpdateInputRecording(unsigned long long& actionMask, std::vector<Vector2>& axes, bool isGameTick)
+	{
+		if (!IsRecordingActive)
+			return;
+
+		if (RecordingMode == InputRecordingMode::Record)
+		{
+			RecordFrame(actionMask, axes, isGameTick);
+		}
+		else
+		{
+			ReplayFrame(actionMask, axes, isGameTick);
+		}
+
+		if (isGameTick)
+			RecordingTick++;
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+namespace TEN::Input
+{
+	enum class InputRecordingMode
+	{
+		None,
+		Record,
+		Replay
+	};
+
+	void InitializeInputRecording(InputRecordingMode mode, const std::string& path);
+	void StartInputRecording();
+	void StopInputRecording();
+
+	bool IsInputReplayFinished();
+	bool IsInputReplayDesynced();
+
+	void UpdateInputRecording(unsigned long long& actionMask, std::vector<Vector2>& axes, bool isGameTick);
+}
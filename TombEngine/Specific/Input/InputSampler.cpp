@@ -0,0 +1,181 @@
+#include "framework.h"
+#include "Specific/Input/InputSampler.h"
+
+#include <chrono>
+#include <thread>
+#include <timeapi.h>
+
+#include "Specific/memory/RingBuffer.h"
+
+using namespace TEN::Memory;
+
+// The input sampler reads keyboard state on its own thread at a much higher rate than the 30 Hz game tick
+// and turns state changes into timestamped events. Events travel to the game thread through a lock-free
+// single-producer single-consumer ring buffer. Each tick consumes the events which happened before it started,
+// so presses shorter than a tick are kept for that tick instead of being lost between two polls.
+// NOTE: Windows timer resolution defaults to ~15.6 ms, which would limit sleeping thread to ~64 Hz.
+// It is raised to 1 ms while sampler runs.
+
+namespace TEN::Input
+{
+	constexpr auto SAMPLER_TIMER_PERIOD = 1; // In milliseconds.
+
+	static auto EventBuffer		  = SpscRingBuffer<InputEvent, INPUT_EVENT_BUFFER_SIZE>{};
+	static auto SamplerBackend	  = std::unique_ptr<InputSampleBackend>();
+	static auto SamplerThread	  = std::thread();
+	static auto IsSamplerRunning  = std::atomic<bool>(false);
+	static auto SampleCount		  = std::atomic<unsigned int>(0);
+	static auto DroppedEventCount = std::atomic<unsigned int>(0);
+
+	// Consumer state, only accessed from game thread.
+	static auto SampledKeys	   = std::array<bool, MAX_KEYBOARD_KEYS>{};
+	static auto ConsumerStats  = InputSamplerStats{};
+	static auto LatencySum	   = 0.0;
+
+	void MockInputSampleBackend::SetKey(int key, bool isDown)
+	{
+		if (key < 0 || key >= MAX_KEYBOARD_KEYS)
+			return;
+
+		_keys[key].store(isDown, std::memory_order_release);
+	}
+
+	bool MockInputSampleBackend::Capture(std::array<bool, MAX_KEYBOARD_KEYS>& keys)
+	{
+		for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+			keys[i] = _keys[i].load(std::memory_order_acquire);
+
+		return true;
+	}
+
+	long long GetInputTime()
+	{
+		auto time = std::chrono::steady_clock::now().time_since_epoch();
+		return std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+	}
+
+	static void SampleInput(int sampleRate)
+	{
+		auto period = std::chrono::microseconds(1000000 / sampleRate);
+		auto nextSampleTime = std::chrono::steady_clock::now();
+
+		auto keys = std::array<bool, MAX_KEYBOARD_KEYS>{};
+		auto prevKeys = std::array<bool, MAX_KEYBOARD_KEYS>{};
+
+		while (IsSamplerRunning.load(std::memory_order_acquire))
+		{
+			if (SamplerBackend->Capture(keys))
+			{
+				long long time = GetInputTime();
+				for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+				{
+					if (keys[i] == prevKeys[i])
+						continue;
+
+					// If buffer is full, keep previous state so that edge is pushed on next sample instead of being lost.
+					if (!EventBuffer.TryPush(InputEvent{ time, (short)i, keys[i] }))
+					{
+						DroppedEventCount.fetch_add(1, std::memory_order_relaxed);
+						continue;
+					}
+
+					prevKeys[i] = keys[i];
+				}
+			}
+
+			SampleCount.fetch_add(1, std::memory_order_relaxed);
+
+			// Don't try to catch up on missed samples after thread was stalled.
+			auto now = std::chrono::steady_clock::now();
+			nextSampleTime += period;
+			if (nextSampleTime < now)
+				nextSampleTime = now + period;
+
+			std::this_thread::sleep_until(nextSampleTime);
+		}
+	}
+
+	void StartInputSampler(std::unique_ptr<InputSampleBackend> backend, int sampleRate)
+	{
+		StopInputSampler();
+
+		if (backend == nullptr || sampleRate <= 0)
+			return;
+
+		SamplerBackend = std::move(backend);
+		EventBuffer.Clear();
+		SampledKeys = {};
+		ConsumerStats = {};
+		LatencySum = 0.0;
+		SampleCount = 0;
+		DroppedEventCount = 0;
+
+		timeBeginPeriod(SAMPLER_TIMER_PERIOD);
+
+		IsSamplerRunning = true;
+		SamplerThread = std::thread(SampleInput, sampleRate);
+
+		TENLog("Sampling input at " + std::to_string(sampleRate) + " Hz.", LogLevel::Info);
+	}
+
+	void StopInputSampler()
+	{
+		if (!IsSamplerRunning)
+			return;
+
+		IsSamplerRunning = false;
+		if (SamplerThread.joinable())
+			SamplerThread.join();
+
+		timeEndPeriod(SAMPLER_TIMER_PERIOD);
+
+		SamplerBackend.reset();
+		EventBuffer.Clear();
+		SampledKeys = {};
+	}
+
+	bool IsInputSamplerActive()
+	{
+		return IsSamplerRunning;
+	}
+
+	// Called once per input update. Keys are set if they are held now or were pressed at any point since previous call.
+	void ConsumeInputEvents(std::array<bool, MAX_KEYBOARD_KEYS>& keys)
+	{
+		auto pressedKeys = std::array<bool, MAX_KEYBOARD_KEYS>{};
+		long long time = GetInputTime();
+
+		// Events sampled after this update started are left for next one.
+		const InputEvent* event = nullptr;
+		while ((event = EventBuffer.Peek()) != nullptr && event->Time <= time)
+		{
+			SampledKeys[event->Key] = event->IsDown;
+			if (event->IsDown)
+				pressedKeys[event->Key] = true;
+
+			double latency = (time - event->Time) / 1000.0;
+			LatencySum += latency;
+			ConsumerStats.MaxLatency = std::max(ConsumerStats.MaxLatency, latency);
+			ConsumerStats.EventCount++;
+
+			EventBuffer.Pop();
+		}
+
+		for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+		{
+			if (pressedKeys[i] && !SampledKeys[i])
+				ConsumerStats.TapCount++;
+
+			keys[i] = (SampledKeys[i] || pressedKeys[i]);
+		}
+	}
+
+	InputSamplerStats GetInputSamplerStats()
+	{
+		auto stats = ConsumerStats;
+		stats.SampleCount = SampleCount.load(std::memory_order_relaxed);
+		stats.DroppedEventCount = DroppedEventCount.load(std::memory_order_relaxed);
+		stats.AverageLatency = (stats.EventCount != 0) ? (LatencySum / stats.EventCount) : 0.0;
+		return stats;
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <atomic>
+
+#include "Specific/Input/Input.h"
+
+namespace TEN::Input
+{
+	constexpr auto INPUT_SAMPLE_RATE	   = 1000; // Samples per second.
+	constexpr auto INPUT_EVENT_BUFFER_SIZE = 1024;
+
+	// Key state edge captured by sampler thread. Time is in microseconds of steady clock.
+	struct InputEvent
+	{
+		long long Time	 = 0;
+		short	  Key	 = 0;
+		bool	  IsDown = false;
+	};
+
+	struct InputSamplerStats
+	{
+		unsigned int SampleCount	   = 0;
+		unsigned int EventCount		   = 0;
+		unsigned int DroppedEventCount = 0; // Events deferred to later sample because buffer was full.
+		unsigned int TapCount		   = 0; // Presses released before consuming tick which were kept for that tick.
+		double		 AverageLatency	   = 0.0; // In milliseconds.
+		double		 MaxLatency		   = 0.0; // In milliseconds.
+	};
+
+	// Device access used by sampler thread. Capture() is only ever called from that thread.
+	class InputSampleBackend
+	{
+	public:
+		virtual ~InputSampleBackend() = default;
+
+		// Fills key states for keyboard slots. Returns false if device could not be read.
+		virtual bool Capture(std::array<bool, MAX_KEYBOARD_KEYS>& keys) = 0;
+	};
+
+	// Scripted device for headless runs and benchmarks. Key states may be set from any thread.
+	class MockInputSampleBackend : public InputSampleBackend
+	{
+	private:
+		std::array<std::atomic<bool>, MAX_KEYBOARD_KEYS> _keys = {};
+
+	public:
+		void SetKey(int key, bool isDown);
+		bool Capture(std::array<bool, MAX_KEYBOARD_KEYS>& keys) override;
+	};
+
+	long long GetInputTime();
+
+	void StartInputSampler(std::unique_ptr<InputSampleBackend> backend, int sampleRate = INPUT_SAMPLE_RATE);
+	void StopInputSampler();
+	bool IsInputSamplerActive();
+
+	void ConsumeInputEvents(std::array<bool, MAX_KEYBOARD_KEYS>& keys);
+	InputSamplerStats GetInputSamplerStats();
+}
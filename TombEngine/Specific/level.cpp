@@ -10,6 +10,7 @@
 #include "Game/control/control.h"
 #include "Game/control/volume.h"
 #include "Game/control/lot.h"
+#include "Game/control/trigger.h"
 #include "Game/items.h"
 #include "Game/Lara/lara.h"
 #include "Game/Lara/lara_initialise.h"
@@ -229,6 +230,9 @@ void LoadItems()
 			g_GameScriptEntities->TryAddColliding((short)i);
 
 			memcpy(&item->StartPose, &item->Pose, sizeof(Pose));
+
+			// Index before initialization, as some objects look up other items by slot on init.
+			UpdateItemObjectIndex(i);
 		}
 
 		// Initialize items.
@@ -923,10 +927,13 @@ void LoadRooms()
 
 	ReadRooms();
 	BuildOutsideRoomsTable();
+	InitializeRoomGrid();
 
 	int numFloorData = ReadInt32(); 
 	g_Level.FloorData.resize(numFloorData);
 	ReadBytes(g_Level.FloorData.data(), numFloorData * sizeof(short));
+
+	CompileTriggers();
 }
 
 void FreeLevel()
@@ -0,0 +1,246 @@
+#pragma once
+#include <algorithm>
+#include <array>
+
+// A fixed-capacity slot allocator for effect arrays. Elements stay in their existing arrays; the pool only tracks slots.
+// Free slots are linked through an intrusive free list, live slots are packed into a dense list for iteration,
+// and live slots are also linked in allocation order, so the oldest one can be evicted in constant time.
+// Reserved slots at the start of the array are always live and are never released or evicted.
+
+namespace TEN::Memory
+{
+	template<size_t N>
+	class FixedPool
+	{
+		static_assert(N > 0, "FixedPool requires a non-zero capacity.");
+
+	public:
+		static constexpr int NO_SLOT = -1;
+
+	private:
+		std::array<int, N> _dense	 = {}; // Live slots, packed.
+		std::array<int, N> _densePos = {}; // Position of slot in dense list, or NO_SLOT if free.
+		std::array<int, N> _next	 = {}; // Next free slot while free, next younger slot while live.
+		std::array<int, N> _prev	 = {}; // Next older slot while live.
+
+		int _count		   = 0;
+		int _reservedCount = 0;
+		int _freeHead	   = NO_SLOT;
+		int _oldest		   = NO_SLOT;
+		int _newest		   = NO_SLOT;
+
+	public:
+		FixedPool(int reservedCount = 0)
+		{
+			_reservedCount = std::clamp(reservedCount, 0, (int)N);
+			Clear();
+		}
+
+		// Getters
+
+		int GetCount() const
+		{
+			return _count;
+		}
+
+		int GetCapacity() const
+		{
+			return (int)N;
+		}
+
+		// Returns slot at given position in dense list. Reserved slots come first.
+		int operator [](int index) const
+		{
+			return _dense[index];
+		}
+
+		// Inquirers
+
+		bool IsLive(int slot) const
+		{
+			return (_densePos[slot] != NO_SLOT);
+		}
+
+		bool IsFull() const
+		{
+			return (_freeHead == NO_SLOT);
+		}
+
+		// Utilities
+
+		void Clear()
+		{
+			_count = 0;
+			_oldest = NO_SLOT;
+			_newest = NO_SLOT;
+
+			for (int slot = 0; slot < _reservedCount; slot++)
+			{
+				_dense[_count] = slot;
+				_densePos[slot] = _count++;
+			}
+
+			// Link free slots in ascending order, so lowest slots are handed out first.
+			_freeHead = NO_SLOT;
+			for (int slot = (int)N - 1; slot >= _reservedCount; slot--)
+			{
+				_densePos[slot] = NO_SLOT;
+				_next[slot] = _freeHead;
+				_freeHead = slot;
+			}
+		}
+
+		// Returns free slot, or NO_SLOT if pool is full.
+		int Allocate()
+		{
+			if (_freeHead == NO_SLOT)
+				return NO_SLOT;
+
+			int slot = _freeHead;
+			_freeHead = _next[slot];
+
+			_dense[_count] = slot;
+			_densePos[slot] = _count++;
+			LinkNewest(slot);
+			return slot;
+		}
+
+		// Returns free slot. If pool is full, evicts oldest live slot.
+		int AllocateOrEvict()
+		{
+			return AllocateOrEvict([](int slot) { return true; });
+		}
+
+		// Returns free slot. If pool is full, evicts oldest live slot for which canEvict() returns true,
+		// or oldest live slot if there is none. Evicted slot stays live and becomes newest.
+		template <typename TFunc>
+		int AllocateOrEvict(TFunc canEvict)
+		{
+			int slot = Allocate();
+			if (slot != NO_SLOT || _oldest == NO_SLOT)
+				return slot;
+
+			slot = _oldest;
+			for (int candidate = _oldest; candidate != NO_SLOT; candidate = _next[candidate])
+			{
+				if (canEvict(candidate))
+				{
+					slot = candidate;
+					break;
+				}
+			}
+
+			Unlink(slot);
+			LinkNewest(slot);
+			return slot;
+		}
+
+		// Returns free slot. If pool is full, reuses oldest live slot for which isLive() returns false,
+		// i.e. element which died but was not swept yet. Returns NO_SLOT if there is none.
+		template <typename TFunc>
+		int AllocateOrReclaim(TFunc isLive)
+		{
+			int slot = Allocate();
+			if (slot != NO_SLOT)
+				return slot;
+
+			for (int candidate = _oldest; candidate != NO_SLOT; candidate = _next[candidate])
+			{
+				if (isLive(candidate))
+					continue;
+
+				Unlink(candidate);
+				LinkNewest(candidate);
+				return candidate;
+			}
+
+			return NO_SLOT;
+		}
+
+		void Release(int slot)
+		{
+			if (slot < _reservedCount || _densePos[slot] == NO_SLOT)
+				return;
+
+			// Move last dense entry into freed position.
+			int pos = _densePos[slot];
+			int lastSlot = _dense[--_count];
+			_dense[pos] = lastSlot;
+			_densePos[lastSlot] = pos;
+			_densePos[slot] = NO_SLOT;
+
+			Unlink(slot);
+			_next[slot] = _freeHead;
+			_freeHead = slot;
+		}
+
+		// Releases live slots for which isLive() returns false. Safe to call after iterating dense list.
+		template <typename TFunc>
+		void Sweep(TFunc isLive)
+		{
+			for (int i = _count - 1; i >= _reservedCount; i--)
+			{
+				int slot = _dense[i];
+				if (!isLive(slot))
+					Release(slot);
+			}
+		}
+
+		// Rebuilds pool from element state, e.g. after elements were written directly by savegame loading.
+		template <typename TFunc>
+		void Rebuild(TFunc isLive)
+		{
+			Clear();
+
+			_freeHead = NO_SLOT;
+			for (int slot = (int)N - 1; slot >= _reservedCount; slot--)
+			{
+				if (isLive(slot))
+					continue;
+
+				_next[slot] = _freeHead;
+				_freeHead = slot;
+			}
+
+			for (int slot = _reservedCount; slot < (int)N; slot++)
+			{
+				if (!isLive(slot))
+					continue;
+
+				_dense[_count] = slot;
+				_densePos[slot] = _count++;
+				LinkNewest(slot);
+			}
+		}
+
+	private:
+		void LinkNewest(int slot)
+		{
+			_prev[slot] = _newest;
+			_next[slot] = NO_SLOT;
+
+			if (_newest != NO_SLOT)
+				_next[_newest] = slot;
+			else
+				_oldest = slot;
+
+			_newest = slot;
+		}
+
+		void Unlink(int slot)
+		{
+			int prev = _prev[slot];
+			int next = _next[slot];
+
+			if (prev != NO_SLOT)
+				_next[prev] = next;
+			else
+				_oldest = next;
+
+			if (next != NO_SLOT)
+				_prev[next] = prev;
+			else
+				_newest = prev;
+		}
+	};
+}
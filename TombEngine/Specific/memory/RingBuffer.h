@@ -0,0 +1,98 @@
+#pragma once
+#include <array>
+#include <atomic>
+
+// A lock-free ring buffer for exactly one producer thread and one consumer thread.
+// The producer only writes the tail and the consumer only writes the head, so no locks or CAS loops are needed.
+// Capacity must be a power of two. One slot is kept empty to tell a full buffer from an empty one.
+
+namespace TEN::Memory
+{
+	template<typename T, size_t N>
+	class SpscRingBuffer
+	{
+		static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRingBuffer capacity must be a power of two.");
+
+	private:
+		static constexpr size_t MASK = N - 1;
+
+		std::array<T, N> _elements = {};
+
+		// Head and tail are kept on separate cache lines to avoid false sharing between threads.
+		alignas(64) std::atomic<size_t> _head = 0;
+		alignas(64) std::atomic<size_t> _tail = 0;
+
+	public:
+		// Getters
+
+		size_t GetCapacity() const
+		{
+			return (N - 1);
+		}
+
+		// Approximate when called while other thread is active.
+		size_t GetCount() const
+		{
+			return ((_tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire)) & MASK);
+		}
+
+		// Inquirers
+
+		bool IsEmpty() const
+		{
+			return (_head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire));
+		}
+
+		// Producer utilities
+
+		// Returns false if buffer is full. Element is not written in that case.
+		bool TryPush(const T& element)
+		{
+			size_t tail = _tail.load(std::memory_order_relaxed);
+			size_t nextTail = (tail + 1) & MASK;
+			if (nextTail == _head.load(std::memory_order_acquire))
+				return false;
+
+			_elements[tail] = element;
+			_tail.store(nextTail, std::memory_order_release);
+			return true;
+		}
+
+		// Consumer utilities
+
+		// Returns pointer to oldest element without removing it, or nullptr if buffer is empty.
+		const T* Peek() const
+		{
+			size_t head = _head.load(std::memory_order_relaxed);
+			if (head == _tail.load(std::memory_order_acquire))
+				return nullptr;
+
+			return &_elements[head];
+		}
+
+		bool TryPop(T& element)
+		{
+			const auto* elementPtr = Peek();
+			if (elementPtr == nullptr)
+				return false;
+
+			element = *elementPtr;
+			Pop();
+			return true;
+		}
+
+		// Removes oldest element. Must only be called after Peek() returned an element.
+		void Pop()
+		{
+			size_t head = _head.load(std::memory_order_relaxed);
+			_head.store((head + 1) & MASK, std::memory_order_release);
+		}
+
+		// Must only be called while producer is stopped.
+		void Clear()
+		{
+			_head.store(0, std::memory_order_relaxed);
+			_tail.store(0, std::memory_order_relaxed);
+		}
+	};
+}
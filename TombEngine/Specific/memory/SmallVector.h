@@ -0,0 +1,222 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+// A vector-like class storing up to N elements inline before spilling to the heap.
+// Intended for small, trivially copyable element types embedded in large arrays (e.g. sectors),
+// where a node-based or always-allocating container would dominate memory footprint.
+
+namespace TEN::Memory
+{
+	template<typename T, size_t N>
+	class SmallVector
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "SmallVector requires a trivially copyable type.");
+		static_assert(N > 0, "SmallVector requires a non-zero inline capacity.");
+
+	private:
+		union
+		{
+			T  _inline[N];
+			T* _heap;
+		};
+
+		unsigned short _size	 = 0;
+		unsigned short _capacity = N;
+
+	public:
+		SmallVector()
+		{
+		}
+
+		SmallVector(const SmallVector& other)
+		{
+			CopyFrom(other);
+		}
+
+		SmallVector(SmallVector&& other) noexcept
+		{
+			MoveFrom(other);
+		}
+
+		~SmallVector()
+		{
+			Release();
+		}
+
+		SmallVector& operator =(const SmallVector& other)
+		{
+			if (this != &other)
+			{
+				Release();
+				CopyFrom(other);
+			}
+
+			return *this;
+		}
+
+		SmallVector& operator =(SmallVector&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Release();
+				MoveFrom(other);
+			}
+
+			return *this;
+		}
+
+		// Element access
+
+		T& operator [](size_t index)
+		{
+			return data()[index];
+		}
+
+		const T& operator [](size_t index) const
+		{
+			return data()[index];
+		}
+
+		T* data()
+		{
+			return IsInline() ? _inline : _heap;
+		}
+
+		const T* data() const
+		{
+			return IsInline() ? _inline : _heap;
+		}
+
+		// Iterators
+
+		T* begin()
+		{
+			return data();
+		}
+
+		const T* begin() const
+		{
+			return data();
+		}
+
+		T* end()
+		{
+			return (data() + _size);
+		}
+
+		const T* end() const
+		{
+			return (data() + _size);
+		}
+
+		// Capacity
+
+		bool empty() const
+		{
+			return (_size == 0);
+		}
+
+		size_t size() const
+		{
+			return _size;
+		}
+
+		size_t capacity() const
+		{
+			return _capacity;
+		}
+
+		// Modifiers
+
+		void clear()
+		{
+			_size = 0;
+		}
+
+		void push_back(const T& value)
+		{
+			insert(end(), value);
+		}
+
+		T* insert(const T* pos, const T& value)
+		{
+			size_t index = pos - data();
+			if (_size == _capacity)
+				Grow();
+
+			auto* elements = data();
+			std::memmove(&elements[index + 1], &elements[index], (_size - index) * sizeof(T));
+			elements[index] = value;
+			_size++;
+
+			return &elements[index];
+		}
+
+		T* erase(const T* pos)
+		{
+			size_t index = pos - data();
+
+			auto* elements = data();
+			std::memmove(&elements[index], &elements[index + 1], (_size - index - 1) * sizeof(T));
+			_size--;
+
+			return &elements[index];
+		}
+
+	private:
+		bool IsInline() const
+		{
+			return (_capacity == N);
+		}
+
+		void Grow()
+		{
+			size_t newCapacity = (size_t)_capacity * 2;
+
+			auto* newHeap = new T[newCapacity];
+			std::memcpy(newHeap, data(), _size * sizeof(T));
+
+			Release();
+			_heap = newHeap;
+			_capacity = (unsigned short)newCapacity;
+		}
+
+		void Release()
+		{
+			if (!IsInline())
+				delete[] _heap;
+
+			_capacity = N;
+		}
+
+		void CopyFrom(const SmallVector& other)
+		{
+			if (!other.IsInline())
+				_heap = new T[other._capacity];
+
+			_capacity = other._capacity;
+			_size = other._size;
+			std::memcpy(data(), other.data(), _size * sizeof(T));
+		}
+
+		void MoveFrom(SmallVector& other)
+		{
+			if (other.IsInline())
+			{
+				std::memcpy(_inline, other._inline, other._size * sizeof(T));
+			}
+			else
+			{
+				_heap = other._heap;
+			}
+
+			_capacity = other._capacity;
+			_size = other._size;
+
+			other._capacity = N;
+			other._size = 0;
+		}
+	};
+}
@@ -8,10 +8,14 @@
 #include <codecvt>
 #include <filesystem>
 
+#include "Game/collision/Point.h"
 #include "Game/control/control.h"
+#include "Game/control/CreatureScheduler.h"
+#include "Game/control/CreatureSensing.h"
 #include "Game/savegame.h"
 #include "Renderer/Renderer.h"
 #include "Sound/sound.h"
+#include "Specific/Input/InputRecording.h"
 #include "Specific/level.h"
 #include "Specific/configuration.h"
 #include "Specific/trutils.h"
@@ -19,6 +23,9 @@
 #include "Scripting/Include/ScriptInterfaceState.h"
 #include "Scripting/Include/ScriptInterfaceLevel.h"
 
+using namespace TEN::Collision::Point;
+using namespace TEN::Control::Scheduler;
+using namespace TEN::Control::Sensing;
 using namespace TEN::Renderer;
 using namespace TEN::Input;
 using namespace TEN::Utils;
@@ -33,6 +40,9 @@ unsigned int ThreadID;
 uintptr_t ThreadHandle;
 HACCEL hAccTable;
 bool DebugMode = false;
+bool BenchmarkMode = false;
+bool HeadlessMode = false;
+int  HeadlessFrameCount = HEADLESS_FRAME_COUNT_DEFAULT;
 HWND WindowsHandle;
 DWORD MainThreadID;
 
@@ -49,6 +59,22 @@ bool ArgEquals(wchar_t* incomingArg, std::string name)
 	return (lowerArg == "-" + name) || (lowerArg == "/" + name);
 }
 
+std::optional<int> ParseIntArg(wchar_t* incomingArg)
+{
+	try
+	{
+		size_t length = 0;
+		int value = std::stoi(std::wstring(incomingArg), &length);
+		if (length == std::wcslen(incomingArg))
+			return value;
+	}
+	catch (const std::exception&)
+	{
+	}
+
+	return std::nullopt;
+}
+
 Vector2i GetScreenResolution()
 {
 	RECT desktop;
@@ -237,6 +263,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	int argc;
 	argv = CommandLineToArgvW(GetCommandLineW(), &argc);
 	std::string gameDir{};
+	auto argWarnings = std::vector<std::string>{}; // NOTE: Logged once log is initialized.
 
 	// Parse command line arguments.
 	for (int i = 1; i < argc; i++)
@@ -249,6 +276,55 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 		{
 			DebugMode = true;
 		}
+		else if (ArgEquals(argv[i], "benchmark"))
+		{
+			BenchmarkMode = true;
+			EnablePointCollisionTiming(true);
+		}
+		else if (ArgEquals(argv[i], "headless"))
+		{
+			HeadlessMode = true;
+		}
+		else if (ArgEquals(argv[i], "frames") && argc > (i + 1))
+		{
+			auto frameCount = ParseIntArg(argv[i + 1]);
+			if (frameCount.has_value() && *frameCount > 0)
+			{
+				HeadlessFrameCount = *frameCount;
+			}
+			else
+			{
+				argWarnings.push_back("Invalid -frames value " + TEN::Utils::ToString(argv[i + 1]) + ". Using default headless frame count.");
+			}
+		}
+		else if (ArgEquals(argv[i], "probecache"))
+		{
+			EnablePointCollisionCache(true);
+		}
+		else if (ArgEquals(argv[i], "parallelai"))
+		{
+			EnableCreatureSensing(true);
+		}
+		else if (ArgEquals(argv[i], "aistaleness") && argc > (i + 1))
+		{
+			auto frameCount = ParseIntArg(argv[i + 1]);
+			if (frameCount.has_value())
+			{
+				SetCreatureLodMaxStaleness(*frameCount);
+			}
+			else
+			{
+				argWarnings.push_back("Invalid -aistaleness value " + TEN::Utils::ToString(argv[i + 1]) + ". Using default creature AI staleness.");
+			}
+		}
+		else if (ArgEquals(argv[i], "record") && argc > (i + 1))
+		{
+			InitializeInputRecording(InputRecordingMode::Record, TEN::Utils::ToString(argv[i + 1]));
+		}
+		else if (ArgEquals(argv[i], "replay") && argc > (i + 1))
+		{
+			InitializeInputRecording(InputRecordingMode::Replay, TEN::Utils::ToString(argv[i + 1]));
+		}
 		else if (ArgEquals(argv[i], "level") && argc > (i + 1))
 		{
 			levelFile = TEN::Utils::ToString(argv[i + 1]);
@@ -279,6 +355,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	// Initialize logging.
 	InitTENLog(gameDir);
 
+	for (const auto& warning : argWarnings)
+		TENLog(warning, LogLevel::Warning);
+
 	// Indicate version.
 	auto ver = GetProductOrFileVersion(false);
 	auto windowName = (std::string("Starting TombEngine version ") +
@@ -362,7 +441,13 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 
 	// Load configuration and optionally show setup dialog.
 	InitDefaultConfiguration();
-	if (setup || !LoadConfiguration())
+	if (HeadlessMode)
+	{
+		// Headless mode never shows setup dialog and runs without audio output.
+		LoadConfiguration();
+		g_Configuration.EnableSound = false;
+	}
+	else if (setup || !LoadConfiguration())
 	{
 		if (!SetupDialog())
 		{
@@ -437,7 +522,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 		App.isInScene = false;
 
 		UpdateWindow(WindowsHandle);
-		ShowWindow(WindowsHandle, nShowCmd);
+		ShowWindow(WindowsHandle, HeadlessMode ? SW_HIDE : nShowCmd);
 
 		SetCursor(NULL);
 		ShowCursor(FALSE);
@@ -466,7 +551,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	while (DoTheGame);
 
 	WinClose();
-	exit(EXIT_SUCCESS);
+	exit((IsInputReplayDesynced() || HasHeadlessCheckFailed()) ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 
 void WinClose()
@@ -14,6 +14,9 @@
 
 using namespace TEN::Math;
 
+constexpr auto HEADLESS_FRAME_COUNT_DEFAULT = 1800;
+constexpr auto HEADLESS_RANDOM_SEED		   = 0;
+
 struct WINAPP
 {
     HINSTANCE hInstance;
@@ -25,6 +28,9 @@ struct WINAPP
 };
 
 extern bool DebugMode;
+extern bool BenchmarkMode;
+extern bool HeadlessMode;
+extern int  HeadlessFrameCount;
 extern HWND WindowsHandle;
 
 // return handle